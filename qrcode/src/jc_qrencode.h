@@ -53,10 +53,14 @@ USAGE:
     }
 
     // Save a png file
-    stbi_write_png("out.png", qr->size, qr->size, 1, qr->data, 256); // Stride is currently 256 bytes
+    stbi_write_png("out.png", qr->size, qr->size, 1, qr->data, qr->stride);
 
     free(qr); // free the qr code
 
+    With the 'kanji' option, the input is treated as UTF-8, and the Japanese characters (U+3000 and up) that exist in Shift JIS are encoded in Kanji mode.
+    Readers return those characters as Shift JIS, see jc_qrencode_get_kanji_unicode() to convert them back.
+    Define JC_QRE_NO_KANJI before including the implementation to leave out the Kanji table (~27kb).
+
 */
 
 
@@ -75,11 +79,11 @@ const static uint32_t JC_QRE_ERROR_CORRECTION_LEVEL_HIGH       = 3;
 
 typedef struct _JCQRCode
 {
-    uint8_t* data;      // The modules of the qrcode
+    uint8_t* data;      // The modules of the qrcode (0 = black, 255 = white)
     uint32_t size;      // Size (in modules) of one side of the qrcode
     uint32_t version;   // Version [1,40]
     uint32_t ecl;       // Error correction level
-    uint32_t _pad;
+    uint32_t stride;    // Number of bytes per row in data
 } JCQRCode;
 
 /** Creates a QR Code
@@ -103,6 +107,128 @@ JCQRCode* jc_qrencode(const uint8_t* input, uint32_t inputlength);
 */
 JCQRCode* jc_qrencode_version(const uint8_t* input, uint32_t inputlength, uint32_t version, uint32_t ecl);
 
+/** An encoder context holds all the memory needed to create a QR Code.
+* Allocate it once and reuse it, to avoid allocating and clearing it for every code.
+* A context must not be used by more than one thread at a time.
+*/
+typedef struct _JCQRCodeInternal JCQRCodeContext;
+
+/** Creates an encoder context
+* @return 0 if the context couldn't be allocated. The context must be deallocated with jc_qrencode_destroy_context()
+*/
+JCQRCodeContext* jc_qrencode_create_context();
+
+/** Destroys an encoder context
+*/
+void jc_qrencode_destroy_context(JCQRCodeContext* ctx);
+
+/** Creates a QR Code, same as jc_qrencode(), but using a context
+* Only the parts of the context that the chosen version uses are cleared.
+*
+* @ctx The encoder context
+* @input Byte array
+* @inputlength Size of input array
+* @return 0 if the qr code couldn't be created. The returned qrcode is owned by the context, and is valid until the next call using the same context
+*/
+JCQRCode* jc_qrencode_with_context(JCQRCodeContext* ctx, const uint8_t* input, uint32_t inputlength);
+
+/** Creates a QR Code, same as jc_qrencode_version(), but using a context
+*
+* @ctx The encoder context
+* @input Byte array
+* @inputlength Size of input array
+* @version Version [1,40]
+* @ecl Error correction level
+* @return 0 if the qr code couldn't be created. The returned qrcode is owned by the context, and is valid until the next call using the same context
+*/
+JCQRCode* jc_qrencode_version_with_context(JCQRCodeContext* ctx, const uint8_t* input, uint32_t inputlength, uint32_t version, uint32_t ecl);
+
+const static uint32_t JC_QRE_MASK_AUTO = 8;
+
+/** Settings for jc_qrencode_options_with_context(). Use jc_qrencode_init_options() to get the defaults
+*/
+typedef struct _JCQRCodeOptions
+{
+    uint32_t min_version;   // The smallest version to use [1,40] (default 1)
+    uint32_t max_version;   // The largest version to use [1,40] (default 40)
+    uint32_t ecl;           // The lowest error correction level to use. A higher level is used if it fits the same version (default JC_QRE_ERROR_CORRECTION_LEVEL_LOW)
+    uint32_t mask;          // The mask pattern [0,7], or JC_QRE_MASK_AUTO to pick the one with the lowest penalty (default). A fixed mask skips the mask evaluation
+    uint32_t kanji;         // If non zero, the Japanese characters of UTF-8 input are encoded in Kanji mode where it's smaller (default 0)
+} JCQRCodeOptions;
+
+/** Sets the default options (the same choices as jc_qrencode_with_context())
+*/
+void jc_qrencode_init_options(JCQRCodeOptions* options);
+
+/** Creates a QR Code, same as jc_qrencode_with_context(), but with the version, error correction level and mask constrained by the options
+*
+* @ctx The encoder context
+* @input Byte array
+* @inputlength Size of input array
+* @options The options
+* @return 0 if the qr code couldn't be created (or didn't fit the max version). The returned qrcode is owned by the context, and is valid until the next call using the same context
+*/
+JCQRCode* jc_qrencode_options_with_context(JCQRCodeContext* ctx, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options);
+
+/** Finds the version and error correction level that jc_qrencode_options_with_context() would use, without encoding the data.
+* Useful for sizing textures before creating the codes
+*
+* @ctx The encoder context
+* @input Byte array
+* @inputlength Size of input array
+* @options The options
+* @return 0 if the input doesn't fit. Otherwise the size, version and ecl are set, and the data is 0.
+*         The returned qrcode is owned by the context, and is valid until the next call using the same context
+*/
+JCQRCode* jc_qrencode_plan(JCQRCodeContext* ctx, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options);
+
+/** Creates a QR Code by updating the last code created with the context. Useful for codes where only a few characters change each time.
+* If the new input fits the version and error correction level of the last code (and the options allow them), those are kept along with the mask,
+* and only the code words that changed (and the error correction of their blocks) are redrawn.
+* Otherwise it creates a new code, same as jc_qrencode_options_with_context()
+*
+* @ctx The encoder context
+* @input Byte array
+* @inputlength Size of input array
+* @options The options. A fixed mask that differs from the mask of the last code creates a new code
+* @return 0 if the qr code couldn't be created. The returned qrcode is owned by the context, and is valid until the next call using the same context
+*/
+JCQRCode* jc_qrencode_update(JCQRCodeContext* ctx, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options);
+
+const static uint32_t JC_QRE_NUM_KANJI_VALUES   = 8192;
+
+/** Gets the unicode character of each 13 bit Kanji mode value, for converting decoded Kanji segments back to UTF-8
+*
+* @unicode An array of JC_QRE_NUM_KANJI_VALUES, which gets the character of each value (or 0 for unused values)
+*/
+void jc_qrencode_get_kanji_unicode(uint16_t* unicode);
+
+const static uint32_t JC_QRE_MODE_NUMERIC       = 0;
+const static uint32_t JC_QRE_MODE_ALPHANUMERIC  = 1;
+const static uint32_t JC_QRE_MODE_BYTE          = 2;
+const static uint32_t JC_QRE_MODE_KANJI         = 3;
+
+/** A segment of the input, encoded with a single mode
+*/
+typedef struct _JCQRCodeSegmentInput
+{
+    const uint8_t*  data;
+    uint32_t        length; // Size of the data array
+    uint32_t        mode;   // JC_QRE_MODE_NUMERIC, JC_QRE_MODE_ALPHANUMERIC, JC_QRE_MODE_BYTE or JC_QRE_MODE_KANJI (the data is UTF-8)
+} JCQRCodeSegmentInput;
+
+/** Creates a QR Code from a list of segments, for callers that know the structure of their data.
+* (The other functions split the input into segments automatically)
+*
+* @ctx The encoder context
+* @segments Array of segments. Each segment's data must be valid for its mode
+* @num_segments Size of segments array
+* @version Version [1,40], or 0 to select the smallest version, and the highest error correction level that fits (ecl is then ignored)
+* @ecl Error correction level
+* @return 0 if the qr code couldn't be created. The returned qrcode is owned by the context, and is valid until the next call using the same context
+*/
+JCQRCode* jc_qrencode_segments_with_context(JCQRCodeContext* ctx, const JCQRCodeSegmentInput* segments, uint32_t num_segments, uint32_t version, uint32_t ecl);
+
 
 #if defined(JC_QRENCODE_IMPLEMENTATION)
 
@@ -246,17 +372,30 @@ static const uint32_t JC_QRE_ALIGNMENT_POSITIONS[] = {
        6,   30,   58,   86,  114,  142,  170,    0,
 };
 
-typedef struct _JCQRCodeBitBuffer
+#define JC_QRE_MAX_SIZE             177 // the size of a version 40 symbol
+#define JC_QRE_LINE_OFFSET          4   // bit offset of the first module in a packed line
+#define JC_QRE_LINE_WORDS           4   // words per packed line, including a trailing zero word
+#define JC_QRE_NUM_AUTO_MODES       4   // numeric, alphanumeric, byte and kanji
+#define JC_QRE_MASK_PERIOD          12  // the mask patterns repeat every 12 modules
+#define JC_QRE_MAX_EC_CODEWORDS     30  // max error correction code words per block
+#define JC_QRE_MAX_BLOCK_CODEWORDS  160 // max data + error correction code words per block (the largest is 153)
+#define JC_QRE_MAX_DATA_MODULES     29648 // the number of data modules in a version 40 symbol
+
+// Writes bits into a byte buffer, most significant bit first
+typedef struct _JCQRCodeBitWriter
 {
-    uint8_t* bits;      // pointer to payload
-    uint32_t numbits;   // current offset (in bits)
-    JC_QRE_PAD(4);
-} JCQRCodeBitBuffer;
+    uint8_t* buffer;
+    uint64_t accum;     // The pending bits (the lowest 'numbits' bits), not yet written to the buffer
+    uint32_t numbits;   // Number of pending bits [0,31]
+    uint32_t cursor;    // Number of bytes written to the buffer
+} JCQRCodeBitWriter;
 
 typedef struct _JCQRCodeSegment
 {
-    JCQRCodeBitBuffer   data;
-    uint32_t            offset;
+    const uint8_t*      input;          // The input, which is encoded once the version is known
+    uint32_t            length;         // Size of the input (in bytes)
+    uint32_t            numbits;        // Size of the encoded data (in bits)
+    uint32_t            offset;         // Size of the previous segments (in bytes)
     uint32_t            elementcount;   // character, bytes, or kanji characters
     uint8_t             type;           // numeric, alphanumeric, byte, kanji
     JC_QRE_PAD(7);
@@ -266,101 +405,129 @@ typedef struct _JCQRCodeInternal
 {
     JCQRCode qrcode; // the output
 
-    uint8_t  bitbuffer[4096];       // storage for all the segments. Each segment starts at a byte boundary
-    uint8_t  databuffer[4096];      // all segments merged into one buffer (appended one after each other)
+    uint8_t  databuffer[4096];      // all segments, encoded one after each other
     uint8_t  errorcorrection[4096]; // storage for the error correction code words
     uint8_t  interleaved[4096];     // all interleaved blocks, including error correction
-    uint8_t  image[256*256];        // Enough to store the largest version (177*177)
-    uint8_t  image_fun[256*256];    // Holds info about whether a module is a function module or not
-
-    JCQRCodeSegment segments[8];
+    uint8_t  image[JC_QRE_MAX_SIZE*JC_QRE_MAX_SIZE]; // The output, one byte per module. Only written once the code is finished
+
+    uint8_t  rs_generators[JC_QRE_MAX_EC_CODEWORDS+1][JC_QRE_MAX_EC_CODEWORDS]; // Reed-Solomon generators, indexed by the number of error correction code words
+    uint32_t rs_generators_built;   // Bit N is set when rs_generators[N] has been created
+
+    // The packed lines hold one bit per module, offset by JC_QRE_LINE_OFFSET, and 'stride' words per line
+    uint32_t stride;                                        // Number of words per line for the current version, including a trailing zero word
+    uint64_t valid[JC_QRE_LINE_WORDS];                      // The bits of a line that hold modules
+    uint64_t modules[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];    // The modules of each row (1 = black)
+    uint64_t function[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];   // The function modules of each row
+    uint64_t rows[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];       // The modules of each row, with the mask being scored
+    uint64_t cols[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];       // The modules of each column, with the mask being scored
+    uint64_t base_cols[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];  // The modules of each column, before masking
+    uint64_t data_cols[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];  // The (maskable) data modules of each column. Part of the template
+    uint64_t mask_rows[8][JC_QRE_MASK_PERIOD][JC_QRE_LINE_WORDS]; // The mask patterns, per row
+    uint64_t mask_cols[8][JC_QRE_MASK_PERIOD][JC_QRE_LINE_WORDS]; // The mask patterns, per column
+    uint32_t mask_planes_built;
+    uint32_t mask;              // The mask to draw, or JC_QRE_MASK_AUTO
+
+    // The function patterns and the data module placement only depend on the version, so they are kept until the version changes.
+    // The function modules and the data columns of the template are kept in 'function' and 'data_cols', which aren't modified when encoding
+    uint32_t template_version;                                          // The version of the template, or 0 if not built
+    uint32_t num_placements;                                            // Number of data modules
+    uint64_t template_modules[JC_QRE_MAX_SIZE*JC_QRE_LINE_WORDS];       // The function patterns, copied into 'modules' before the data is placed
+    uint16_t placements[JC_QRE_MAX_DATA_MODULES];                       // The position (y << 8 | x) of each data module, in the order the bits are placed
+
+    // The last code drawn, which jc_qrencode_update() can modify. Its code words are kept in 'interleaved', and its modules in 'modules' and 'image'
+    uint32_t last_version;      // 0 if there is no code
+    uint32_t last_ecl;
+    uint32_t last_mask;
+
+    JCQRCodeSegment* segments;  // grows as needed
     uint32_t num_segments;
+    uint32_t max_segments;
+    uint8_t* charmodes;         // scratch space for the automatic segmentation. Grows as needed
+    uint32_t charmodes_size;
     uint32_t datasize;          // number of bytes used in databuffer
     uint32_t interleavedsize;   // number of bytes used in interleaved
 } JCQRCodeInternal;
 
 
-// Store the integer with the most significant bit first
-static inline uint32_t _jc_qre_bitbuffer_write(uint8_t* buffer, uint32_t buffersize, uint32_t* cursor, uint32_t input, uint32_t numbits)
+static inline void _jc_qre_bitwriter_init(JCQRCodeBitWriter* writer, uint8_t* buffer)
 {
-    uint32_t num_bytes_to_traverse = (numbits + 7) / 8;
-    if( *cursor / 8 + num_bytes_to_traverse >= buffersize )
-    {
-        return 0;
-    }
-    if( numbits > 32 )
+    writer->buffer = buffer;
+    writer->accum = 0;
+    writer->numbits = 0;
+    writer->cursor = 0;
+}
+
+// Writes the lowest 'numbits' bits [0,32] of the value. The caller makes sure that the buffer is large enough
+static inline void _jc_qre_bitwriter_write(JCQRCodeBitWriter* writer, uint32_t value, uint32_t numbits)
+{
+    if( numbits == 0 )
+        return;
+    writer->accum = (writer->accum << numbits) | (value & (0xFFFFFFFFu >> (32 - numbits)));
+    writer->numbits += numbits;
+    if( writer->numbits >= 32 )
     {
-        return 0;
+        writer->numbits -= 32;
+        uint32_t word = (uint32_t)(writer->accum >> writer->numbits);
+        uint8_t* out = &writer->buffer[writer->cursor];
+        out[0] = (uint8_t)(word >> 24);
+        out[1] = (uint8_t)(word >> 16);
+        out[2] = (uint8_t)(word >> 8);
+        out[3] = (uint8_t)word;
+        writer->cursor += 4;
     }
+}
 
-    uint32_t pos = *cursor; // in bits
-
-//print_bits("encode:", input, numbits);
-
-    for( uint32_t i = 0; i < numbits; ++i, ++pos)
+// Writes the whole bytes of the pending bits to the buffer
+static inline void _jc_qre_bitwriter_flush_bytes(JCQRCodeBitWriter* writer)
+{
+    while( writer->numbits >= 8 )
     {
-        uint32_t targetindex = 7 - pos & 0x7;
-
-        uint32_t ii = numbits - 1 - i;
-        uint8_t inputbit = (input >> ii) & 1;
-
-        buffer[pos/8] |= (uint8_t)(inputbit << targetindex);
-//printf(" %u  %u    %u: %u\n", pos, pos/8, i, (inputbit << targetindex));
-
-//print_bits("byte:", buffer[pos/8], 8);
-
+        writer->numbits -= 8;
+        writer->buffer[writer->cursor++] = (uint8_t)(writer->accum >> writer->numbits);
     }
-    *cursor += numbits;
-
-//printf("\n");
-
-    return 1;
 }
 
-// Appends a previously encoded segment into another
-static inline uint32_t _jc_qre_bitbuffer_append(uint8_t* buffer, uint32_t buffersize, uint32_t* cursor, uint8_t* input, uint32_t numbits)
+// Writes a byte array. When the writer is byte aligned, the bytes are copied directly
+static inline void _jc_qre_bitwriter_write_bytes(JCQRCodeBitWriter* writer, const uint8_t* input, uint32_t length)
 {
-    uint32_t num_bytes_to_traverse = (numbits + 7) / 8;
-    if( *cursor + num_bytes_to_traverse >= buffersize )
-        return 0;
-
-    uint32_t pos = *cursor; // in bits
-    for( uint32_t i = 0; i < numbits; ++i, ++pos )
+    _jc_qre_bitwriter_flush_bytes(writer);
+    if( writer->numbits == 0 )
     {
-        uint32_t targetindex = 7 - pos & 0x7;
-
-        uint8_t inputbit = input[i / 8] >> (7 - (i & 7)) & 1;
+        memcpy(&writer->buffer[writer->cursor], input, length);
+        writer->cursor += length;
+        return;
+    }
 
-        // clear the target bit and OR in the input bit
-        buffer[pos/8] |= (uint8_t)(inputbit << targetindex);
+    uint32_t i = 0;
+    for( ; i + 4 <= length; i += 4 )
+    {
+        uint32_t word = ((uint32_t)input[i] << 24) | ((uint32_t)input[i+1] << 16) | ((uint32_t)input[i+2] << 8) | (uint32_t)input[i+3];
+        _jc_qre_bitwriter_write(writer, word, 32);
+    }
+    for( ; i < length; ++i )
+    {
+        _jc_qre_bitwriter_write(writer, input[i], 8);
     }
+}
 
-    *cursor += numbits;
-    return 1;
+// Returns the number of bits written so far
+static inline uint32_t _jc_qre_bitwriter_size(const JCQRCodeBitWriter* writer)
+{
+    return writer->cursor * 8 + writer->numbits;
 }
 
-static inline uint32_t _jc_qre_bitbuffer_read(uint8_t* buffer, uint32_t buffersize, uint32_t* cursor, uint32_t numbits)
+// Writes the pending bits, padded with zeros to a byte boundary
+static inline void _jc_qre_bitwriter_finish(JCQRCodeBitWriter* writer)
 {
-    uint32_t pos = *cursor; // in bits
-    uint32_t value = 0;
-    for( uint32_t i = 0; i < numbits; ++i, ++pos)
+    _jc_qre_bitwriter_flush_bytes(writer);
+    if( writer->numbits )
     {
-        if( pos / 8 >= buffersize )
-            break;
-
-        uint8_t currentvalue = buffer[pos / 8];
-
-        uint32_t srcindex = 7 - pos & 0x7;
-
-        uint32_t srcbit = (currentvalue & (1 << srcindex)) ? 1 : 0;
-
-        value = (value & ~(1 << i)) | (srcbit << i);
+        writer->buffer[writer->cursor++] = (uint8_t)(writer->accum << (8 - writer->numbits));
+        writer->numbits = 0;
     }
-
-    *cursor = pos;
-    return value;
 }
 
+
 static inline uint32_t _jc_qre_guess_type_numeric(const uint8_t* input, uint32_t inputlength)
 {
     for( uint32_t i = 0; i < inputlength; ++i )
@@ -387,17 +554,978 @@ static inline uint32_t _jc_qre_guess_type_alphanumeric(const uint8_t* input, uin
     return 1;
 }
 
-static inline uint8_t _jc_qre_guess_type(const uint8_t* input, uint32_t inputlength)
+#if !defined(JC_QRE_NO_KANJI)
+// The characters of the Kanji mode (Shift JIS 0x8140-0x9FFC and 0xE040-0xEBBF), as (unicode << 13) | (13 bit kanji value)
+// Sorted by unicode
+static const uint32_t JC_QRE_KANJI_TABLE[] = {
+    0x00144051, 0x00146052, 0x0014e058, 0x0015000e, 0x0015808a, 0x0016004b, 0x0016203d, 0x0016800c,
+    0x0016c0b7, 0x001ae03e, 0x001ee040, 0x007221df, 0x007241e0, 0x007261e1, 0x007281e2, 0x0072a1e3,
+    0x0072c1e4, 0x0072e1e5, 0x007301e6, 0x007321e7, 0x007341e8, 0x007361e9, 0x007381ea, 0x0073a1eb,
+    0x0073c1ec, 0x0073e1ed, 0x007401ee, 0x007421ef, 0x007461f0, 0x007481f1, 0x0074a1f2, 0x0074c1f3,
+    0x0074e1f4, 0x007501f5, 0x007521f6, 0x007621ff, 0x00764200, 0x00766201, 0x00768202, 0x0076a203,
+    0x0076c204, 0x0076e205, 0x00770206, 0x00772207, 0x00774208, 0x00776209, 0x0077820a, 0x0077a20b,
+    0x0077c20c, 0x0077e20d, 0x0078020e, 0x0078220f, 0x00786210, 0x00788211, 0x0078a212, 0x0078c213,
+    0x0078e214, 0x00790215, 0x00792216, 0x00802246, 0x00820240, 0x00822241, 0x00824242, 0x00826243,
+    0x00828244, 0x0082a245, 0x0082c247, 0x0082e248, 0x00830249, 0x0083224a, 0x0083424b, 0x0083624c,
+    0x0083824d, 0x0083a24e, 0x0083c24f, 0x0083e250, 0x00840251, 0x00842252, 0x00844253, 0x00846254,
+    0x00848255, 0x0084a256, 0x0084c257, 0x0084e258, 0x00850259, 0x0085225a, 0x0085425b, 0x0085625c,
+    0x0085825d, 0x0085a25e, 0x0085c25f, 0x0085e260, 0x00860270, 0x00862271, 0x00864272, 0x00866273,
+    0x00868274, 0x0086a275, 0x0086c277, 0x0086e278, 0x00870279, 0x0087227a, 0x0087427b, 0x0087627c,
+    0x0087827d, 0x0087a27e, 0x0087c280, 0x0087e281, 0x00880282, 0x00882283, 0x00884284, 0x00886285,
+    0x00888286, 0x0088a287, 0x0088c288, 0x0088e289, 0x0089028a, 0x0089228b, 0x0089428c, 0x0089628d,
+    0x0089828e, 0x0089a28f, 0x0089c290, 0x0089e291, 0x008a2276, 0x0402001d, 0x0402a01c, 0x0402c021,
+    0x04030025, 0x04032026, 0x04038027, 0x0403a028, 0x040400b5, 0x040420b6, 0x0404a024, 0x0404c023,
+    0x040600b1, 0x0406404c, 0x0406604d, 0x04076066, 0x0420604e, 0x042560b0, 0x04320069, 0x0432206a,
+    0x04324068, 0x0432606b, 0x043a408b, 0x043a808c, 0x0440008d, 0x0440409d, 0x0440608e, 0x0440e09e,
+    0x04410078, 0x04416079, 0x0442403c, 0x044340a3, 0x0443a0a5, 0x0443c047, 0x0444009a, 0x0444e088,
+    0x04450089, 0x0445207f, 0x0445407e, 0x044560a7, 0x044580a8, 0x04468048, 0x0446a0a6, 0x0447a0a4,
+    0x044a40a0, 0x044c0042, 0x044c209f, 0x044cc045, 0x044ce046, 0x044d40a1, 0x044d60a2, 0x0450407c,
+    0x0450607d, 0x0450c07a, 0x0450e07b, 0x0454a09b, 0x0462409c, 0x04a0029f, 0x04a022aa, 0x04a042a0,
+    0x04a062ab, 0x04a182a1, 0x04a1e2ac, 0x04a202a2, 0x04a262ad, 0x04a282a4, 0x04a2e2af, 0x04a302a3,
+    0x04a362ae, 0x04a382a5, 0x04a3a2ba, 0x04a402b5, 0x04a462b0, 0x04a482a7, 0x04a4a2bc, 0x04a502b7,
+    0x04a562b2, 0x04a582a6, 0x04a5e2b6, 0x04a602bb, 0x04a662b1, 0x04a682a8, 0x04a6e2b8, 0x04a702bd,
+    0x04a762b3, 0x04a782a9, 0x04a7e2b9, 0x04a842be, 0x04a962b4, 0x04b40061, 0x04b42060, 0x04b64063,
+    0x04b66062, 0x04b78065, 0x04b7a064, 0x04b8c05f, 0x04b8e05e, 0x04b9605b, 0x04b9c05d, 0x04b9e05c,
+    0x04bde0bc, 0x04c0a05a, 0x04c0c059, 0x04c8004a, 0x04c84049, 0x04cd40b4, 0x04cda0b3, 0x04cde0b2,
+    0x06000000, 0x06002001, 0x06004002, 0x06006016, 0x0600a018, 0x0600c019, 0x0600e01a, 0x06010031,
+    0x06012032, 0x06014033, 0x06016034, 0x06018035, 0x0601a036, 0x0601c037, 0x0601e038, 0x06020039,
+    0x0602203a, 0x06024067, 0x0602606c, 0x0602802b, 0x0602a02c, 0x06038020, 0x0608211f, 0x06084120,
+    0x06086121, 0x06088122, 0x0608a123, 0x0608c124, 0x0608e125, 0x06090126, 0x06092127, 0x06094128,
+    0x06096129, 0x0609812a, 0x0609a12b, 0x0609c12c, 0x0609e12d, 0x060a012e, 0x060a212f, 0x060a4130,
+    0x060a6131, 0x060a8132, 0x060aa133, 0x060ac134, 0x060ae135, 0x060b0136, 0x060b2137, 0x060b4138,
+    0x060b6139, 0x060b813a, 0x060ba13b, 0x060bc13c, 0x060be13d, 0x060c013e, 0x060c213f, 0x060c4140,
+    0x060c6141, 0x060c8142, 0x060ca143, 0x060cc144, 0x060ce145, 0x060d0146, 0x060d2147, 0x060d4148,
+    0x060d6149, 0x060d814a, 0x060da14b, 0x060dc14c, 0x060de14d, 0x060e014e, 0x060e214f, 0x060e4150,
+    0x060e6151, 0x060e8152, 0x060ea153, 0x060ec154, 0x060ee155, 0x060f0156, 0x060f2157, 0x060f4158,
+    0x060f6159, 0x060f815a, 0x060fa15b, 0x060fc15c, 0x060fe15d, 0x0610015e, 0x0610215f, 0x06104160,
+    0x06106161, 0x06108162, 0x0610a163, 0x0610c164, 0x0610e165, 0x06110166, 0x06112167, 0x06114168,
+    0x06116169, 0x0611816a, 0x0611a16b, 0x0611c16c, 0x0611e16d, 0x0612016e, 0x0612216f, 0x06124170,
+    0x06126171, 0x0613600a, 0x0613800b, 0x0613a014, 0x0613c015, 0x06142180, 0x06144181, 0x06146182,
+    0x06148183, 0x0614a184, 0x0614c185, 0x0614e186, 0x06150187, 0x06152188, 0x06154189, 0x0615618a,
+    0x0615818b, 0x0615a18c, 0x0615c18d, 0x0615e18e, 0x0616018f, 0x06162190, 0x06164191, 0x06166192,
+    0x06168193, 0x0616a194, 0x0616c195, 0x0616e196, 0x06170197, 0x06172198, 0x06174199, 0x0617619a,
+    0x0617819b, 0x0617a19c, 0x0617c19d, 0x0617e19e, 0x0618019f, 0x061821a0, 0x061841a1, 0x061861a2,
+    0x061881a3, 0x0618a1a4, 0x0618c1a5, 0x0618e1a6, 0x061901a7, 0x061921a8, 0x061941a9, 0x061961aa,
+    0x061981ab, 0x0619a1ac, 0x0619c1ad, 0x0619e1ae, 0x061a01af, 0x061a21b0, 0x061a41b1, 0x061a61b2,
+    0x061a81b3, 0x061aa1b4, 0x061ac1b5, 0x061ae1b6, 0x061b01b7, 0x061b21b8, 0x061b41b9, 0x061b61ba,
+    0x061b81bb, 0x061ba1bc, 0x061bc1bd, 0x061be1be, 0x061c01c0, 0x061c21c1, 0x061c41c2, 0x061c61c3,
+    0x061c81c4, 0x061ca1c5, 0x061cc1c6, 0x061ce1c7, 0x061d01c8, 0x061d21c9, 0x061d41ca, 0x061d61cb,
+    0x061d81cc, 0x061da1cd, 0x061dc1ce, 0x061de1cf, 0x061e01d0, 0x061e21d1, 0x061e41d2, 0x061e61d3,
+    0x061e81d4, 0x061ea1d5, 0x061ec1d6, 0x061f6005, 0x061f801b, 0x061fa012, 0x061fc013, 0x09c005ea,
+    0x09c02d1a, 0x09c06a35, 0x09c0f01c, 0x09c10b24, 0x09c129cf, 0x09c14b23, 0x09c1667a, 0x09c1af33,
+    0x09c1d09e, 0x09c211a0, 0x09c2260e, 0x09c2870e, 0x09c2b1a1, 0x09c2cba2, 0x09c2f280, 0x09c307b5,
+    0x09c32f78, 0x09c3cb25, 0x09c430fc, 0x09c4cf80, 0x09c551a2, 0x09c5ad06, 0x09c631a3, 0x09c64838,
+    0x09c6d1a4, 0x09c7075b, 0x09c72ccf, 0x09c76a65, 0x09c791a5, 0x09c7f1a6, 0x09c851a7, 0x09c86e54,
+    0x09c8a7b6, 0x09c96e56, 0x09c9ae21, 0x09c9c8c1, 0x09c9efd2, 0x09cabb28, 0x09cad1a8, 0x09caeb26,
+    0x09cb11a9, 0x09cb2673, 0x09cba823, 0x09cbc8ee, 0x09cbf067, 0x09cc53e4, 0x09ce30d0, 0x09ce6e3b,
+    0x09cfc723, 0x09d00794, 0x09d051aa, 0x09d0b1ab, 0x09d0d0f9, 0x09d1109c, 0x09d12c48, 0x09d151ad,
+    0x09d16a16, 0x09d18e31, 0x09d1d1b0, 0x09d2261d, 0x09d248dd, 0x09d288dc, 0x09d2a5e4, 0x09d3116a,
+    0x09d33169, 0x09d36971, 0x09d3859f, 0x09d3d1b1, 0x09d3f1b2, 0x09d411b3, 0x09d42fd3, 0x09d451b4,
+    0x09d488f0, 0x09d4a5e5, 0x09d4d012, 0x09d507dc, 0x09d567dd, 0x09d587de, 0x09d5ad60, 0x09d5d0fa,
+    0x09d611b5, 0x09d671b6, 0x09d6d1b7, 0x09d74b6c, 0x09d80a99, 0x09d82b6d, 0x09d851bc, 0x09d891ba,
+    0x09d8d1bb, 0x09d8e7b7, 0x09d94961, 0x09d966ae, 0x09d9b1b9, 0x09d9d1b8, 0x09d9ef67, 0x09da89e5,
+    0x09daa9e4, 0x09dacc7c, 0x09daf1bd, 0x09db0f34, 0x09db2be5, 0x09dba017, 0x09dbd1be, 0x09dbf1c0,
+    0x09dc6ca3, 0x09dc911f, 0x09dca5c8, 0x09ddb1bf, 0x09ddc67c, 0x09de0802, 0x09de4d07, 0x09dec88f,
+    0x09def1c1, 0x09df6e43, 0x09e02769, 0x09e131c2, 0x09e145c9, 0x09e1a8de, 0x09e1c76a, 0x09e1ef5a,
+    0x09e20eb0, 0x09e227b8, 0x09e346af, 0x09e391e5, 0x09e3ada0, 0x09e5ee8c, 0x09e611c4, 0x09e68eba,
+    0x09e6d120, 0x09e70b4c, 0x09e749e6, 0x09e78a17, 0x09e7a67e, 0x09e86d4f, 0x09e8ccc1, 0x09e8f1c8,
+    0x09e9a5ca, 0x09e9cd61, 0x09e9ea9a, 0x09ea0972, 0x09ea3083, 0x09ea6c8c, 0x09eaa67d, 0x09eaf1c7,
+    0x09eb309d, 0x09eb51c3, 0x09eb71c5, 0x09eb89ac, 0x09ebb1c6, 0x09ebd383, 0x09ed31ce, 0x09edf1d1,
+    0x09ee11cf, 0x09ee6680, 0x09eeaf79, 0x09eed1c9, 0x09ef71cd, 0x09ef88f1, 0x09efe9e7, 0x09f06724,
+    0x09f0d1d2, 0x09f111ca, 0x09f17121, 0x09f1aa18, 0x09f1f1cb, 0x09f231d0, 0x09f2d1d3, 0x09f311cc,
+    0x09f367df, 0x09f3a5cb, 0x09f407e0, 0x09f4267f, 0x09f57384, 0x09f5b019, 0x09f5cf4e, 0x09f5e8f2,
+    0x09f6ab4e, 0x09f6d0f5, 0x09f7ef96, 0x09f84857, 0x09f86c63, 0x09f886a2, 0x09f94ab2, 0x09f9d1d7,
+    0x09fa11dc, 0x09fa31da, 0x09fa91d5, 0x09faec6d, 0x09fb11d8, 0x09fb51db, 0x09fb71d9, 0x09fbaf9b,
+    0x09fbf1d6, 0x09fc2b4d, 0x09fc7013, 0x09fc91dd, 0x09fcb1de, 0x09fdca83, 0x09fdf1eb, 0x09fe6e6f,
+    0x09feaf15, 0x09fed1e6, 0x09ff0fae, 0x09ff4674, 0x09ffd1ea, 0x0a00b1e4, 0x0a00d1ed, 0x0a012c31,
+    0x0a0168c2, 0x0a01ae7b, 0x0a01f7c5, 0x0a0231ec, 0x0a024dbc, 0x0a0291e1, 0x0a02c8f4, 0x0a0328f3,
+    0x0a0351df, 0x0a03ea58, 0x0a0431e7, 0x0a046fad, 0x0a048cec, 0x0a04b1e3, 0x0a04c891, 0x0a0511e0,
+    0x0a0531e8, 0x0a0551e2, 0x0a05710f, 0x0a0591e9, 0x0a05b160, 0x0a06c824, 0x0a072890, 0x0a0871ee,
+    0x0a08f1ef, 0x0a0911f3, 0x0a0925cc, 0x0a09ef8e, 0x0a0a11f2, 0x0a0ab1f1, 0x0a0ad1f5, 0x0a0b51f4,
+    0x0a0b8d62, 0x0a0ca892, 0x0a0d91f6, 0x0a0e4a43, 0x0a0e8c64, 0x0a0ead63, 0x0a0ec834, 0x0a0f11f7,
+    0x0a0fa795, 0x0a1011f8, 0x0a10b1fa, 0x0a11afd4, 0x0a122886, 0x0a1309d0, 0x0a132ef5, 0x0a1351f9,
+    0x0a158983, 0x0a15b0a2, 0x0a1651fc, 0x0a167202, 0x0a1691fb, 0x0a16a982, 0x0a16eadd, 0x0a17c858,
+    0x0a185203, 0x0a18a80d, 0x0a193200, 0x0a195201, 0x0a19aded, 0x0a19ec5c, 0x0a1a27e1, 0x0a1aafec,
+    0x0a1ad204, 0x0a1b50fb, 0x0a1bd205, 0x0a1c7208, 0x0a1cb206, 0x0a1cec2d, 0x0a1db207, 0x0a1dd209,
+    0x0a1eb20b, 0x0a1f320a, 0x0a1f6f86, 0x0a200796, 0x0a20320d, 0x0a20520e, 0x0a20866d, 0x0a21320c,
+    0x0a224a72, 0x0a229211, 0x0a22b210, 0x0a22d20f, 0x0a2311d4, 0x0a235212, 0x0a23eade, 0x0a243213,
+    0x0a255084, 0x0a265057, 0x0a26f215, 0x0a275214, 0x0a277217, 0x0a279216, 0x0a27f218, 0x0a281219,
+    0x0a2825f2, 0x0a2868b3, 0x0a28885a, 0x0a28aa9b, 0x0a28cd1b, 0x0a28e7e2, 0x0a290be6, 0x0a2928f5,
+    0x0a29694e, 0x0a29921b, 0x0a29b046, 0x0a29cda5, 0x0a2a0a19, 0x0a2a521a, 0x0a2a921c, 0x0a2b4dbd,
+    0x0a2b8715, 0x0a2c521d, 0x0a2cae3c, 0x0a2d0c13, 0x0a2d321f, 0x0a2d5220, 0x0a2d6eaa, 0x0a2d88f6,
+    0x0a2db15a, 0x0a2dd221, 0x0a2e27e4, 0x0a2eaf7a, 0x0a2ecc74, 0x0a2ee82f, 0x0a2f0d94, 0x0a2f8893,
+    0x0a301222, 0x0a305223, 0x0a30ae20, 0x0a30c63e, 0x0a313226, 0x0a3149bb, 0x0a319225, 0x0a31a984,
+    0x0a31f227, 0x0a321a2c, 0x0a323228, 0x0a324fe0, 0x0a327229, 0x0a32b22a, 0x0a32d22b, 0x0a32eb27,
+    0x0a332a4a, 0x0a340725, 0x0a34522e, 0x0a34922c, 0x0a34b03b, 0x0a34d22d, 0x0a350f39, 0x0a35322f,
+    0x0a355230, 0x0a357231, 0x0a358dbe, 0x0a361235, 0x0a363233, 0x0a365234, 0x0a367232, 0x0a3689a1,
+    0x0a36b236, 0x0a36d068, 0x0a36f122, 0x0a37b237, 0x0a388ba6, 0x0a38b238, 0x0a38cab9, 0x0a393239,
+    0x0a396d1c, 0x0a3990fd, 0x0a39adc0, 0x0a3ad283, 0x0a3b723a, 0x0a3b9f23, 0x0a3ba803, 0x0a3c123b,
+    0x0a3c2ffd, 0x0a3ccac8, 0x0a3cecba, 0x0a3d323d, 0x0a3d4e22, 0x0a3db23e, 0x0a3e1240, 0x0a3e26cd,
+    0x0a3eb241, 0x0a3ec7e5, 0x0a3f0e0a, 0x0a3f265a, 0x0a3f4aaf, 0x0a3fae9f, 0x0a3fd242, 0x0a400dc1,
+    0x0a406b6e, 0x0a409243, 0x0a40cf6a, 0x0a40ebd8, 0x0a410720, 0x0a414727, 0x0a417244, 0x0a41d246,
+    0x0a422859, 0x0a429245, 0x0a42f131, 0x0a43aac9, 0x0a448ebb, 0x0a44af8a, 0x0a44f247, 0x0a4530d8,
+    0x0a455248, 0x0a45d249, 0x0a460dde, 0x0a46724a, 0x0a46cba7, 0x0a46e9bc, 0x0a470894, 0x0a47324b,
+    0x0a4749e8, 0x0a47694f, 0x0a486d64, 0x0a48924d, 0x0a48ec65, 0x0a4949ad, 0x0a49724e, 0x0a49924f,
+    0x0a49ac0f, 0x0a49f24c, 0x0a4a9251, 0x0a4acfd5, 0x0a4b6944, 0x0a4bd250, 0x0a4c6895, 0x0a4c899c,
+    0x0a4cae8d, 0x0a4d3254, 0x0a4d5252, 0x0a4def5b, 0x0a4e0b28, 0x0a4e325b, 0x0a4e4704, 0x0a4e7255,
+    0x0a4e9253, 0x0a4eac2e, 0x0a4fb257, 0x0a4ff256, 0x0a5066e3, 0x0a50e880, 0x0a51125c, 0x0a5130eb,
+    0x0a51b258, 0x0a52325d, 0x0a52525a, 0x0a529259, 0x0a53710d, 0x0a53e8f7, 0x0a540681, 0x0a547132,
+    0x0a552ad5, 0x0a554db7, 0x0a556945, 0x0a559260, 0x0a55b261, 0x0a563123, 0x0a56914a, 0x0a56b263,
+    0x0a5728f8, 0x0a579262, 0x0a57c6ce, 0x0a583264, 0x0a586ff5, 0x0a58ad3a, 0x0a58f085, 0x0a592f97,
+    0x0a59b265, 0x0a5a5dd3, 0x0a5aadee, 0x0a5af266, 0x0a5b0728, 0x0a5b3031, 0x0a5baadf, 0x0a5bd267,
+    0x0a5befa5, 0x0a5c126b, 0x0a5c4ba8, 0x0a5c7268, 0x0a5c880e, 0x0a5cd269, 0x0a5ce729, 0x0a5e484d,
+    0x0a5e726c, 0x0a5eb26d, 0x0a5f126e, 0x0a5f326f, 0x0a5f4a59, 0x0a5fc8f9, 0x0a5ff05c, 0x0a603066,
+    0x0a604e35, 0x0a60afaf, 0x0a60d270, 0x0a611271, 0x0a61b273, 0x0a61f275, 0x0a621274, 0x0a62b276,
+    0x0a62c67b, 0x0a62efeb, 0x0a6329ba, 0x0a635277, 0x0a63ac38, 0x0a640ae0, 0x0a6427e7, 0x0a647278,
+    0x0a654ed9, 0x0a65f279, 0x0a66327a, 0x0a66727b, 0x0a67127c, 0x0a672f03, 0x0a674826, 0x0a6765e3,
+    0x0a67edfd, 0x0a68127d, 0x0a682a9c, 0x0a686be7, 0x0a68b27f, 0x0a68d27e, 0x0a68eae1, 0x0a6908df,
+    0x0a693281, 0x0a694ebc, 0x0a69b282, 0x0a6a2eda, 0x0a6a4c72, 0x0a6a6cac, 0x0a6a87e6, 0x0a6aee2c,
+    0x0a6b0cd0, 0x0a6b4e8e, 0x0a6b8fed, 0x0a6bd284, 0x0a6c0be8, 0x0a6cc854, 0x0a6d3285, 0x0a6dd286,
+    0x0a6de60b, 0x0a6e05f3, 0x0a6e276b, 0x0a6e6c66, 0x0a6e87b0, 0x0a6eb0d1, 0x0a6ef289, 0x0a6f0675,
+    0x0a6f7288, 0x0a6fe7e8, 0x0a70528a, 0x0a70906f, 0x0a72d28b, 0x0a731110, 0x0a7348fa, 0x0a73e8b4,
+    0x0a74128c, 0x0a74b28e, 0x0a74d28d, 0x0a750b7e, 0x0a752618, 0x0a75a63d, 0x0a75d28f, 0x0a761290,
+    0x0a7668b5, 0x0a76d291, 0x0a7767ce, 0x0a7849d1, 0x0a787292, 0x0a791014, 0x0a792973, 0x0a7947b9,
+    0x0a797086, 0x0a798c2f, 0x0a79aebd, 0x0a79ca7b, 0x0a7a8aa6, 0x0a7aca66, 0x0a7aea73, 0x0a7b2ad6,
+    0x0a7b6ebe, 0x0a7bf295, 0x0a7c2622, 0x0a7c4c30, 0x0a7c68fb, 0x0a7c88c3, 0x0a7ca825, 0x0a7d1299,
+    0x0a7d2cc0, 0x0a7d4cbc, 0x0a7d67e9, 0x0a7d8ae2, 0x0a7db29a, 0x0a7dd298, 0x0a7de682, 0x0a7e0ca4,
+    0x0a7e2a36, 0x0a7e49ea, 0x0a7e6605, 0x0a7ec710, 0x0a7ee946, 0x0a7f09e9, 0x0a7f529b, 0x0a80329c,
+    0x0a8067a8, 0x0a8086e5, 0x0a810947, 0x0a8127a7, 0x0a814d5d, 0x0a816604, 0x0a818def, 0x0a81b03c,
+    0x0a81c900, 0x0a81f0d9, 0x0a820da6, 0x0a8228fc, 0x0a83684e, 0x0a83b2a5, 0x0a83e821, 0x0a840fe9,
+    0x0a84cedb, 0x0a8532a4, 0x0a85675c, 0x0a85929f, 0x0a85b2a0, 0x0a85d2a2, 0x0a86d2a3, 0x0a8707ba,
+    0x0a872b81, 0x0a876f6b, 0x0a8792a1, 0x0a87b29d, 0x0a87c8e1, 0x0a88129e, 0x0a885143, 0x0a88cfb0,
+    0x0a890d66, 0x0a8928e0, 0x0a894950, 0x0a89d2a6, 0x0a8a2e1b, 0x0a8bf2aa, 0x0a8d0a7c, 0x0a8d4a74,
+    0x0a8e12ad, 0x0a8e32ab, 0x0a8e7021, 0x0a8eb2a8, 0x0a8ed2b1, 0x0a8ef2ac, 0x0a8f72af, 0x0a8f88c4,
+    0x0a8fb03d, 0x0a9012b0, 0x0a9092b2, 0x0a90d2b4, 0x0a9169ae, 0x0a919161, 0x0a91d2a9, 0x0a91f2a7,
+    0x0a9212b3, 0x0a9252ae, 0x0a9452b6, 0x0a9492c2, 0x0a94b2b8, 0x0a9512bc, 0x0a9572c0, 0x0a9592b9,
+    0x0a95f2dd, 0x0a9649a7, 0x0a9666d0, 0x0a9712b7, 0x0a9792c4, 0x0a97a5f4, 0x0a97d2c3, 0x0a9805a3,
+    0x0a982f29, 0x0a9852c1, 0x0a9892ba, 0x0a98f2b5, 0x0a9912bb, 0x0a992986, 0x0a9b12c5, 0x0a9c25f5,
+    0x0a9c52ce, 0x0a9cb2c6, 0x0a9cd2c7, 0x0a9d0ae3, 0x0a9d3009, 0x0a9db2cc, 0x0a9dd2cb, 0x0a9e4d8e,
+    0x0a9f52cd, 0x0a9fb2ca, 0x0aa08613, 0x0aa0c974, 0x0aa0eb4f, 0x0aa1f2c8, 0x0aa20dc2, 0x0aa292c9,
+    0x0aa2c5a0, 0x0aa5d2d3, 0x0aa5f082, 0x0aa62ae5, 0x0aa672d9, 0x0aa712d8, 0x0aa732cf, 0x0aa7cc81,
+    0x0aa812d0, 0x0aa88cad, 0x0aa8b2d5, 0x0aa8cae4, 0x0aa992d2, 0x0aa9f062, 0x0aaa685b, 0x0aaad2d6,
+    0x0aaaf2d7, 0x0aab92d4, 0x0aabb2da, 0x0aac72d1, 0x0aaf72e0, 0x0aaf92e5, 0x0aafd2e1, 0x0ab012dc,
+    0x0ab072e6, 0x0ab08c10, 0x0ab0f2e8, 0x0ab12901, 0x0ab152de, 0x0ab16d1d, 0x0ab312e2, 0x0ab332db,
+    0x0ab3472b, 0x0ab3876c, 0x0ab3a705, 0x0ab3d2e3, 0x0ab3f2df, 0x0ab4e896, 0x0ab512e9, 0x0ab532e7,
+    0x0ab54c32, 0x0ab567a9, 0x0ab587ea, 0x0ab5d2e4, 0x0ab60832, 0x0ab6c623, 0x0ab892ed, 0x0ab8b2eb,
+    0x0ab8f325, 0x0aba92f0, 0x0abb52ea, 0x0abb92ee, 0x0abbf2ec, 0x0abc69eb, 0x0abc92ef, 0x0abef2f2,
+    0x0abf32f7, 0x0abfb2f5, 0x0abfd2f4, 0x0ac0ccd1, 0x0ac12683, 0x0ac292f1, 0x0ac2d2f3, 0x0ac2eae6,
+    0x0ac30612, 0x0ac372f6, 0x0ac5269c, 0x0ac5f302, 0x0ac62b3a, 0x0ac652fd, 0x0ac692fb, 0x0ac6d2fc,
+    0x0ac712fe, 0x0ac8461c, 0x0ac98c18, 0x0ac9d2f8, 0x0aca12f9, 0x0acb671a, 0x0acc9301, 0x0acd076d,
+    0x0acd5304, 0x0acd7300, 0x0acd9303, 0x0ace8f6c, 0x0acf0e13, 0x0acf4eb6, 0x0ad01306, 0x0ad0d305,
+    0x0ad0e6e4, 0x0ad15307, 0x0ad1f30a, 0x0ad29309, 0x0ad41308, 0x0ad44e58, 0x0ad4b30b, 0x0ad5d30c,
+    0x0ad6930e, 0x0ad6d30d, 0x0ad79310, 0x0ad81313, 0x0ad83311, 0x0ad8530f, 0x0ad87312, 0x0ad91314,
+    0x0ad9d315, 0x0ada3316, 0x0ada7317, 0x0adaf318, 0x0adb1224, 0x0adb4a7a, 0x0adb69ec, 0x0adbc6b1,
+    0x0adc05f6, 0x0adc6ce3, 0x0addd319, 0x0ade0962, 0x0ade45cd, 0x0ade6b7d, 0x0adf331a, 0x0adf48c5,
+    0x0adfa951, 0x0adff31c, 0x0ae0131b, 0x0ae06f9e, 0x0ae0931d, 0x0ae1131f, 0x0ae1331e, 0x0ae17320,
+    0x0ae1b321, 0x0ae1e897, 0x0ae24640, 0x0ae27322, 0x0ae2d324, 0x0ae31323, 0x0ae39326, 0x0ae3edb9,
+    0x0ae4d327, 0x0ae4e5b3, 0x0ae5099d, 0x0ae5a85c, 0x0ae60cee, 0x0ae6f328, 0x0ae71329, 0x0ae7732b,
+    0x0ae8132c, 0x0ae849a2, 0x0ae8e80f, 0x0ae94fd6, 0x0ae9d32a, 0x0ae9f32d, 0x0aea097f, 0x0aea2902,
+    0x0aec3331, 0x0aec8963, 0x0aecccd2, 0x0aed332e, 0x0aed4d58, 0x0aeff332, 0x0af04b82, 0x0af11330,
+    0x0af13333, 0x0af1685e, 0x0af27334, 0x0af41335, 0x0af44903, 0x0af466df, 0x0af49337, 0x0af55338,
+    0x0af61339, 0x0af67336, 0x0af8132f, 0x0af8733a, 0x0af8d33b, 0x0af97004, 0x0af9cb29, 0x0afa533d,
+    0x0afa733e, 0x0afa933c, 0x0afad340, 0x0afb8e57, 0x0afbe5e6, 0x0afc0f35, 0x0afc7341, 0x0afe8b3b,
+    0x0afeea37, 0x0aff2e7c, 0x0aff476e, 0x0aff89a9, 0x0b000ff8, 0x0b004df0, 0x0b00a898, 0x0b00cc8d,
+    0x0b01533f, 0x0b017342, 0x0b02ac82, 0x0b033343, 0x0b03b344, 0x0b043346, 0x0b048d67, 0x0b05472c,
+    0x0b05ff1f, 0x0b060641, 0x0b062fb1, 0x0b068b2a, 0x0b06ada7, 0x0b0749a4, 0x0b07b34c, 0x0b080f7b,
+    0x0b08311b, 0x0b0946b2, 0x0b097348, 0x0b0a2c19, 0x0b0a534b, 0x0b0a8dc3, 0x0b0aeda8, 0x0b0b0dc4,
+    0x0b0b2eb7, 0x0b0b4d4b, 0x0b0bc987, 0x0b0c5347, 0x0b0d2656, 0x0b0d6d95, 0x0b0e1349, 0x0b0e5345,
+    0x0b0eab6f, 0x0b0f334d, 0x0b0fcaad, 0x0b1067eb, 0x0b10b34e, 0x0b126fa6, 0x0b12ec5d, 0x0b138d44,
+    0x0b13f350, 0x0b150fee, 0x0b157351, 0x0b15d356, 0x0b166f6d, 0x0b171355, 0x0b17334f, 0x0b175352,
+    0x0b177354, 0x0b17c964, 0x0b182f87, 0x0b18b357, 0x0b18ece4, 0x0b1946b3, 0x0b198b2b, 0x0b1a3359,
+    0x0b1a7358, 0x0b1aa948, 0x0b1af35a, 0x0b1b135c, 0x0b1b335b, 0x0b1b935e, 0x0b1bd353, 0x0b1bf360,
+    0x0b1c935f, 0x0b1cb35d, 0x0b1d69ed, 0x0b1d8b70, 0x0b1dcc33, 0x0b1df361, 0x0b1e0bba, 0x0b1e25eb,
+    0x0b1e4e84, 0x0b1eed59, 0x0b1f3363, 0x0b1f5362, 0x0b1f7364, 0x0b1f9365, 0x0b1fb366, 0x0b205367,
+    0x0b212f8f, 0x0b215368, 0x0b21e684, 0x0b221369, 0x0b22b09b, 0x0b22c6cf, 0x0b231287, 0x0b232aa7,
+    0x0b234c7d, 0x0b23736a, 0x0b239069, 0x0b245032, 0x0b24b36c, 0x0b24eca5, 0x0b252d96, 0x0b254c7e,
+    0x0b256f36, 0x0b25936d, 0x0b25b36e, 0x0b25c65b, 0x0b262a38, 0x0b26536f, 0x0b26e5ce, 0x0b271370,
+    0x0b27d371, 0x0b288642, 0x0b28e76f, 0x0b290e1e, 0x0b292fb2, 0x0b29d375, 0x0b29ec34, 0x0b2a1374,
+    0x0b2a285f, 0x0b2a8ffa, 0x0b2ab373, 0x0b2aedc5, 0x0b2b1377, 0x0b2b5376, 0x0b2c1379, 0x0b2c5378,
+    0x0b2ca65c, 0x0b2cf37a, 0x0b2d0ae7, 0x0b2d337c, 0x0b2d4cc4, 0x0b2d937b, 0x0b2dcf71, 0x0b2e6ad7,
+    0x0b2e8dba, 0x0b2f1380, 0x0b2fa904, 0x0b303381, 0x0b304e40, 0x0b306edc, 0x0b30904f, 0x0b314e44,
+    0x0b31b38a, 0x0b326797, 0x0b32d0a4, 0x0b33302d, 0x0b3373ea, 0x0b33b382, 0x0b347385, 0x0b34ac83,
+    0x0b350fd7, 0x0b358da9, 0x0b365386, 0x0b373005, 0x0b376988, 0x0b37cae8, 0x0b38d387, 0x0b3929ef,
+    0x0b3969ee, 0x0b3a05b7, 0x0b3a28c6, 0x0b3a6ba9, 0x0b3a85cf, 0x0b3b338b, 0x0b3b538c, 0x0b3b9389,
+    0x0b3ca617, 0x0b3cc72d, 0x0b3d1388, 0x0b3d5043, 0x0b3d6f10, 0x0b3ec5a6, 0x0b3f65f7, 0x0b3fe9f0,
+    0x0b4025d0, 0x0b4065a1, 0x0b413391, 0x0b42338f, 0x0b43103a, 0x0b435392, 0x0b439390, 0x0b43f38e,
+    0x0b440b50, 0x0b44b38d, 0x0b452f98, 0x0b45e8e2, 0x0b46b396, 0x0b46d397, 0x0b478ae9, 0x0b481393,
+    0x0b48314b, 0x0b48ce6b, 0x0b493395, 0x0b4b4965, 0x0b4c5398, 0x0b4ccf37, 0x0b4d5399, 0x0b4d9394,
+    0x0b4ff039, 0x0b524e7d, 0x0b53539a, 0x0b536f11, 0x0b57939b, 0x0b57b39f, 0x0b57d39c, 0x0b582685,
+    0x0b58539e, 0x0b592a39, 0x0b59739d, 0x0b598899, 0x0b5a13ab, 0x0b5ad3a4, 0x0b5af3a1, 0x0b5c2d04,
+    0x0b5c73a0, 0x0b5cd3a2, 0x0b5d33a3, 0x0b5f53a5, 0x0b5f73a6, 0x0b612770, 0x0b6173a8, 0x0b6193a7,
+    0x0b62d3a9, 0x0b644b2c, 0x0b6553ac, 0x0b658d5a, 0x0b660624, 0x0b6653aa, 0x0b66d3ad, 0x0b67d3ae,
+    0x0b6813b1, 0x0b6873af, 0x0b68b3b0, 0x0b6a09f1, 0x0b6a33b2, 0x0b6a8905, 0x0b6ab3b3, 0x0b6aea1a,
+    0x0b6b0c76, 0x0b6b53b4, 0x0b6b73b5, 0x0b6b89f9, 0x0b6ba906, 0x0b6bf050, 0x0b6c6787, 0x0b6c88c7,
+    0x0b6cb3b6, 0x0b6cc6f7, 0x0b6d33b7, 0x0b6d6c77, 0x0b6e13b8, 0x0b6e33e1, 0x0b6e73b9, 0x0b6eb3ba,
+    0x0b6f13bb, 0x0b6f53bd, 0x0b7013be, 0x0b7073c0, 0x0b70acae, 0x0b70e606, 0x0b710a67, 0x0b7125c0,
+    0x0b716c36, 0x0b71872e, 0x0b71aa33, 0x0b71e907, 0x0b72adc6, 0x0b72ea80, 0x0b73072f, 0x0b732d08,
+    0x0b734d68, 0x0b7365b6, 0x0b738798, 0x0b73afb3, 0x0b73ea40, 0x0b7447b1, 0x0b746be9, 0x0b748a3a,
+    0x0b74b087, 0x0b74d3c1, 0x0b75c7bb, 0x0b760989, 0x0b7666d1, 0x0b768643, 0x0b76aaea, 0x0b76c686,
+    0x0b7713c2, 0x0b7730a5, 0x0b77eaa8, 0x0b784a62, 0x0b7873c3, 0x0b788771, 0x0b78ae10, 0x0b78d027,
+    0x0b78f3c4, 0x0b7933c5, 0x0b798f38, 0x0b7a13c7, 0x0b7a4726, 0x0b7a6835, 0x0b7a93c6, 0x0b7b6730,
+    0x0b7bab51, 0x0b7bd3cb, 0x0b7be9c0, 0x0b7c2687, 0x0b7c53ca, 0x0b7c93c8, 0x0b7cb3cc, 0x0b7cd3c9,
+    0x0b7cee4a, 0x0b7d164b, 0x0b7d2b52, 0x0b7d73cd, 0x0b7dd0fe, 0x0b7e13ce, 0x0b7e73d0, 0x0b7ead1e,
+    0x0b7ed3cf, 0x0b7f0ba1, 0x0b7f4a1b, 0x0b7fcc8e, 0x0b7fea75, 0x0b802f55, 0x0b804bea, 0x0b808a4b,
+    0x0b80b3d1, 0x0b80caeb, 0x0b80f3d2, 0x0b8113d3, 0x0b8125d1, 0x0b814c78, 0x0b816b71, 0x0b81b3d4,
+    0x0b81cdf1, 0x0b81eaec, 0x0b822aed, 0x0b8273d5, 0x0b82cbeb, 0x0b834aee, 0x0b8413d6, 0x0b8453d7,
+    0x0b84905e, 0x0b8513d8, 0x0b85a804, 0x0b862a81, 0x0b8713d9, 0x0b8733da, 0x0b874a5a, 0x0b876b4b,
+    0x0b878e32, 0x0b87ab73, 0x0b87cef6, 0x0b87ee41, 0x0b880807, 0x0b8833db, 0x0b88a7cf, 0x0b88d3dc,
+    0x0b89083c, 0x0b894e0d, 0x0b89666e, 0x0b89a9f2, 0x0b89d3dd, 0x0b89f3e0, 0x0b8a13df, 0x0b8a283b,
+    0x0b8a73de, 0x0b8aad97, 0x0b8bcc6e, 0x0b8c0daa, 0x0b8c2a46, 0x0b8c8c37, 0x0b8cb0da, 0x0b8d93e2,
+    0x0b8dd3e3, 0x0b8dee14, 0x0b8e29d2, 0x0b8ed3e5, 0x0b8f33e6, 0x0b9193e7, 0x0b920772, 0x0b9233e8,
+    0x0b9293e9, 0x0b94266a, 0x0b950c1a, 0x0b952762, 0x0b9573eb, 0x0b959026, 0x0b962c90, 0x0b9666f8,
+    0x0b96d3ed, 0x0b96f3ef, 0x0b97075d, 0x0b9773ec, 0x0b9793ee, 0x0b97d3f1, 0x0b98b3f0, 0x0b98f3f2,
+    0x0b9b33f3, 0x0b9c0dfb, 0x0b9c27ec, 0x0b9d06a3, 0x0b9d33f4, 0x0b9d53f9, 0x0b9db3f7, 0x0b9defb5,
+    0x0b9e0fb4, 0x0b9ecdc7, 0x0b9f53f6, 0x0b9f6ab3, 0x0b9fb3f5, 0x0ba0eb92, 0x0ba173fa, 0x0ba1c9a8,
+    0x0ba23400, 0x0ba29401, 0x0ba2b3fb, 0x0ba2c6d2, 0x0ba2f3fc, 0x0ba31405, 0x0ba33404, 0x0ba35403,
+    0x0ba373ff, 0x0ba3f3fe, 0x0ba45402, 0x0ba52fb6, 0x0ba97409, 0x0ba99406, 0x0ba9d408, 0x0baa10d2,
+    0x0baa5407, 0x0bab93fd, 0x0bad2b93, 0x0bad940a, 0x0bade975, 0x0bae740b, 0x0baed40c, 0x0bb0540f,
+    0x0bb0940e, 0x0bb0f40d, 0x0bb16dc8, 0x0bb193f8, 0x0bb21415, 0x0bb3b411, 0x0bb45410, 0x0bb59412,
+    0x0bb5d413, 0x0bb6f416, 0x0bb75124, 0x0bb79417, 0x0bb7b414, 0x0bb93418, 0x0bb9875e, 0x0bb9b419,
+    0x0bba541b, 0x0bba741a, 0x0bbad41c, 0x0bbb741d, 0x0bbbabec, 0x0bbbca82, 0x0bbc2ac4, 0x0bbc6c43,
+    0x0bbca908, 0x0bbcc976, 0x0bbce909, 0x0bbd07d0, 0x0bbd741e, 0x0bbdc977, 0x0bbe28c8, 0x0bbe541f,
+    0x0bbe7024, 0x0bbe8e62, 0x0bbeb420, 0x0bbee90a, 0x0bbf672a, 0x0bbfacc6, 0x0bbfc810, 0x0bc049f3,
+    0x0bc06f3a, 0x0bc0cebf, 0x0bc17421, 0x0bc18773, 0x0bc23424, 0x0bc2cd1f, 0x0bc33423, 0x0bc35422,
+    0x0bc37425, 0x0bc3ad69, 0x0bc4ab83, 0x0bc569f4, 0x0bc5abc8, 0x0bc5ec91, 0x0bc60781, 0x0bc66d20,
+    0x0bc6d426, 0x0bc6f427, 0x0bc70b2d, 0x0bc7afd8, 0x0bc8142a, 0x0bc87429, 0x0bc89428, 0x0bc8af5d,
+    0x0bc8f431, 0x0bc98ff9, 0x0bc9d42b, 0x0bca942d, 0x0bcab00b, 0x0bcaf42c, 0x0bcbf42e, 0x0bcc2ea6,
+    0x0bcc542f, 0x0bcc6f7c, 0x0bcc9430, 0x0bce4731, 0x0bce6f7d, 0x0bce8e4e, 0x0bceb432, 0x0bced433,
+    0x0bcf090b, 0x0bcf2732, 0x0bcf5434, 0x0bcf68b6, 0x0bcf90a3, 0x0bcfb088, 0x0bcfc774, 0x0bcff436,
+    0x0bd02d21, 0x0bd0690c, 0x0bd08aef, 0x0bd0eedd, 0x0bd14af0, 0x0bd1ead8, 0x0bd2ad6a, 0x0bd2cfb7,
+    0x0bd2ed98, 0x0bd3490d, 0x0bd38f3b, 0x0bd41437, 0x0bd4cdb8, 0x0bd4e980, 0x0bd568c9, 0x0bd5ad6b,
+    0x0bd6a5c1, 0x0bd6cace, 0x0bd6e90e, 0x0bd710a6, 0x0bd83438, 0x0bd85439, 0x0bd86e70, 0x0bd9143a,
+    0x0bd93135, 0x0bd9514c, 0x0bd9f43c, 0x0bda143b, 0x0bda66e6, 0x0bdad440, 0x0bdb5443, 0x0bdb7444,
+    0x0bdbb442, 0x0bdbef1f, 0x0bdc0af1, 0x0bdc3446, 0x0bdc5445, 0x0bdc7441, 0x0bdd1447, 0x0bdd3448,
+    0x0bdd9449, 0x0bde144c, 0x0bde344a, 0x0bde744b, 0x0bde944d, 0x0bdec644, 0x0bdeed6c, 0x0bdf144e,
+    0x0bdf489a, 0x0bdf66b4, 0x0bdf8e55, 0x0bdfd44f, 0x0bdfee39, 0x0be02f99, 0x0be07450, 0x0be0914d,
+    0x0be13451, 0x0be14f7e, 0x0be17454, 0x0be1919f, 0x0be1b1af, 0x0be1ea2e, 0x0be20e33, 0x0be23455,
+    0x0be267bc, 0x0be28d22, 0x0be2a5f8, 0x0be2d456, 0x0be2ef64, 0x0be3090f, 0x0be36cef, 0x0be3ed6d,
+    0x0be4b06d, 0x0be4c8b7, 0x0be4e8ca, 0x0be53457, 0x0be5b458, 0x0be5f45e, 0x0be62a63, 0x0be6ad23,
+    0x0be6e7ed, 0x0be71459, 0x0be78f0a, 0x0be7cce5, 0x0be8345a, 0x0be9145b, 0x0be947ee, 0x0be9945c,
+    0x0be9d45d, 0x0bea345f, 0x0bea6dd6, 0x0bead460, 0x0beaf461, 0x0beb3462, 0x0beb9453, 0x0bebb452,
+    0x0bec3463, 0x0bec4860, 0x0beccf06, 0x0bed298a, 0x0bed4f16, 0x0bed6d24, 0x0bed8f2a, 0x0bedb464,
+    0x0bee0af2, 0x0bee2625, 0x0bee7465, 0x0beef466, 0x0bef3070, 0x0bef8ede, 0x0beff469, 0x0bf0065d,
+    0x0bf02baa, 0x0bf05468, 0x0bf07467, 0x0bf08861, 0x0bf0ac92, 0x0bf0f46d, 0x0bf1146b, 0x0bf1546a,
+    0x0bf170e5, 0x0bf188e3, 0x0bf20ad9, 0x0bf2346c, 0x0bf24dab, 0x0bf26a9d, 0x0bf2edfe, 0x0bf31470,
+    0x0bf3346f, 0x0bf3d46e, 0x0bf41471, 0x0bf428e4, 0x0bf51472, 0x0bf52f5c, 0x0bf54aba, 0x0bf5b473,
+    0x0bf5cef7, 0x0bf66dff, 0x0bf68d25, 0x0bf72d8f, 0x0bf79474, 0x0bf7a78a, 0x0bf86b53, 0x0bf8af0b,
+    0x0bf98775, 0x0bf9ae45, 0x0bfad475, 0x0bfae9f5, 0x0bfb0fd9, 0x0bfb2fda, 0x0bfb865e, 0x0bfbb47a,
+    0x0bfc0d09, 0x0bfc9477, 0x0bfd66b5, 0x0bfe14ab, 0x0bfe3479, 0x0bfeae4f, 0x0bff1478, 0x0bff7476,
+    0x0bffa95a, 0x0bfff47c, 0x0c01d483, 0x0c01f489, 0x0c021481, 0x0c024dbb, 0x0c02b486, 0x0c02cf3c,
+    0x0c033480, 0x0c037485, 0x0c039125, 0x0c03a9f6, 0x0c040c93, 0x0c04347d, 0x0c04a7bd, 0x0c04d488,
+    0x0c04ebab, 0x0c050645, 0x0c053482, 0x0c0546b6, 0x0c057487, 0x0c05e7ef, 0x0c063484, 0x0c07548a,
+    0x0c08348c, 0x0c085496, 0x0c087494, 0x0c08d491, 0x0c095490, 0x0c097136, 0x0c09b492, 0x0c0a07f0,
+    0x0c0a4910, 0x0c0aaada, 0x0c0b3499, 0x0c0b548b, 0x0c0bf48f, 0x0c0c147e, 0x0c0c46b8, 0x0c0c7493,
+    0x0c0c9495, 0x0c0cacf0, 0x0c0d0966, 0x0c0d2676, 0x0c0d548d, 0x0c0d7498, 0x0c0d9497, 0x0c0da7f1,
+    0x0c0dec67, 0x0c0e0706, 0x0c0ea862, 0x0c0ef48e, 0x0c10349a, 0x0c10749d, 0x0c10949f, 0x0c112a3b,
+    0x0c1174a5, 0x0c118d6e, 0x0c11b49b, 0x0c1254a3, 0x0c1286b7, 0x0c12d4a1, 0x0c12f4a2, 0x0c13549e,
+    0x0c1374a0, 0x0c13e8e5, 0x0c141089, 0x0c146733, 0x0c14c638, 0x0c14f4a4, 0x0c152e59, 0x0c1545ab,
+    0x0c164edf, 0x0c16747b, 0x0c1694aa, 0x0c16b4ae, 0x0c16d063, 0x0c1714a7, 0x0c178dc9, 0x0c17b4ac,
+    0x0c18ab2e, 0x0c18d4ad, 0x0c18ee15, 0x0c1a3166, 0x0c1a74a9, 0x0c1b14af, 0x0c1b495b, 0x0c1b8bc9,
+    0x0c1be5d2, 0x0c1c14a8, 0x0c1c34a6, 0x0c1c6c39, 0x0c1cf49c, 0x0c1d09d3, 0x0c1e0c84, 0x0c1e34bb,
+    0x0c1e6c3a, 0x0c1e94b6, 0x0c1ed4b3, 0x0c1ef4b4, 0x0c1f2a64, 0x0c1f54b7, 0x0c1f74ba, 0x0c2014b5,
+    0x0c202a84, 0x0c2074b8, 0x0c20d4b2, 0x0c21107a, 0x0c213079, 0x0c21b4bc, 0x0c21d4bd, 0x0c21e5d3,
+    0x0c22b4b1, 0x0c234830, 0x0c2365a4, 0x0c23e734, 0x0c2434b9, 0x0c24f4c1, 0x0c2514c0, 0x0c2594c5,
+    0x0c2694c6, 0x0c2794c4, 0x0c27b4c7, 0x0c27d4bf, 0x0c27f4c3, 0x0c2854c8, 0x0c2894c9, 0x0c28f4be,
+    0x0c290a1c, 0x0c2954c2, 0x0c296c94, 0x0c298911, 0x0c29b4b0, 0x0c29cb54, 0x0c2a74d6, 0x0c2aafa7,
+    0x0c2b14cc, 0x0c2b34cd, 0x0c2b54ce, 0x0c2bb4d5, 0x0c2bf4d4, 0x0c2c501d, 0x0c2c6735, 0x0c2cb4d2,
+    0x0c2ce864, 0x0c2d06d3, 0x0c2d74cf, 0x0c2dd0f6, 0x0c2df4d1, 0x0c2e05d4, 0x0c2e34d3, 0x0c2e74ca,
+    0x0c2e94d0, 0x0c2eb4d7, 0x0c2ec863, 0x0c2ef4cb, 0x0c2fd0bc, 0x0c30508a, 0x0c30f4da, 0x0c3154de,
+    0x0c31cc5e, 0x0c321137, 0x0c3234df, 0x0c3294dc, 0x0c32d4d9, 0x0c3334d8, 0x0c3354dd, 0x0c348f6e,
+    0x0c34edf2, 0x0c352865, 0x0c3574e0, 0x0c3594db, 0x0c35d4e1, 0x0c36489b, 0x0c36c66f, 0x0c3754e9,
+    0x0c37c736, 0x0c3874e7, 0x0c38d4e8, 0x0c38e967, 0x0c3914e6, 0x0c3934e4, 0x0c3954e3, 0x0c3974ea,
+    0x0c3994e2, 0x0c39b4ec, 0x0c3a06b9, 0x0c3c74ee, 0x0c3cd4ed, 0x0c3e4d26, 0x0c3e94f1, 0x0c3ed4ef,
+    0x0c3ef4e5, 0x0c3f089c, 0x0c3f54f0, 0x0c3f94f4, 0x0c3fb4f3, 0x0c3fd4f5, 0x0c3ff4f2, 0x0c4014f6,
+    0x0c4114f7, 0x0c4134f8, 0x0c414fa8, 0x0c4194fa, 0x0c41b4f9, 0x0c41ca9e, 0x0c420bac, 0x0c4226a4,
+    0x0c4246ba, 0x0c4294fb, 0x0c42c5bd, 0x0c434bca, 0x0c4374fc, 0x0c43bc41, 0x0c43d500, 0x0c43e881,
+    0x0c443501, 0x0c44cbed, 0x0c455502, 0x0c45d503, 0x0c45e799, 0x0c461504, 0x0c465505, 0x0c467506,
+    0x0c468c95, 0x0c4708cb, 0x0c47705f, 0x0c47efdb, 0x0c480aca, 0x0c483507, 0x0c48ebee, 0x0c491cfb,
+    0x0c492ee0, 0x0c496a68, 0x0c49a98b, 0x0c49d508, 0x0c4a6c85, 0x0c4aaf65, 0x0c4b0caf, 0x0c4b750b,
+    0x0c4bd509, 0x0c4c150c, 0x0c4c750a, 0x0c4d150d, 0x0c4dcf6f, 0x0c4e25b5, 0x0c4ecf3d, 0x0c4f2ee1,
+    0x0c4f950e, 0x0c4fd511, 0x0c4feaf3, 0x0c50079a, 0x0c50550f, 0x0c507516, 0x0c508af4, 0x0c513510,
+    0x0c514e63, 0x0c5230bd, 0x0c525512, 0x0c527513, 0x0c529517, 0x0c52adca, 0x0c52d514, 0x0c52e912,
+    0x0c530bdc, 0x0c537525, 0x0c538eb2, 0x0c53ccb0, 0x0c556ee2, 0x0c55956b, 0x0c562fb8, 0x0c56ad6f,
+    0x0c573015, 0x0c57751a, 0x0c57865f, 0x0c57ad0a, 0x0c585523, 0x0c58acd3, 0x0c58d51d, 0x0c58f524,
+    0x0c59151f, 0x0c593526, 0x0c595522, 0x0c599521, 0x0c59ae8f, 0x0c59f51b, 0x0c5a06bb, 0x0c5a3519,
+    0x0c5a47d1, 0x0c5a6cb1, 0x0c5a9515, 0x0c5af518, 0x0c5b0913, 0x0c5b2bd9, 0x0c5b6af5, 0x0c5b9520,
+    0x0c5bae71, 0x0c5c07d2, 0x0c5c26e7, 0x0c5d8707, 0x0c5dab40, 0x0c5dd528, 0x0c5df52d, 0x0c5e3529,
+    0x0c5e689d, 0x0c5eb52e, 0x0c5ec9c1, 0x0c5ee949, 0x0c5fca85, 0x0c5ff51c, 0x0c602a1d, 0x0c60552b,
+    0x0c60e9f7, 0x0c61152c, 0x0c6125c2, 0x0c619527, 0x0c622d27, 0x0c6327d3, 0x0c63e7f2, 0x0c64f52a,
+    0x0c6505a5, 0x0c656981, 0x0c65eb55, 0x0c674d70, 0x0c67aed2, 0x0c67d530, 0x0c67ec3d, 0x0c692c68,
+    0x0c6989ca, 0x0c69b531, 0x0c69f533, 0x0c6a152f, 0x0c6aaf9f, 0x0c6aed3b, 0x0c6b8c3b, 0x0c6cefb9,
+    0x0c6d0a4c, 0x0c6d3540, 0x0c6d753e, 0x0c6dcb98, 0x0c6e489e, 0x0c6ed538, 0x0c6eeaf7, 0x0c6f4e26,
+    0x0c6f6e50, 0x0c701536, 0x0c706c3c, 0x0c710a76, 0x0c71353b, 0x0c718af6, 0x0c71d535, 0x0c71f53a,
+    0x0c724e72, 0x0c72d534, 0x0c730840, 0x0c7366fc, 0x0c73f53c, 0x0c7410e9, 0x0c74298c, 0x0c744cd4,
+    0x0c747539, 0x0c74abda, 0x0c74e914, 0x0c750b84, 0x0c752646, 0x0c754c1b, 0x0c757537, 0x0c7587a4,
+    0x0c764866, 0x0c768d4d, 0x0c76b53d, 0x0c776c3e, 0x0c77d541, 0x0c781543, 0x0c786c75, 0x0c789549,
+    0x0c78d544, 0x0c793546, 0x0c79ef20, 0x0c7a0d71, 0x0c7a5547, 0x0c7ad08b, 0x0c7b50a7, 0x0c7b6737,
+    0x0c7c25ac, 0x0c7c7545, 0x0c7d3542, 0x0c7dc776, 0x0c7e8647, 0x0c7ed548, 0x0c7f50a8, 0x0c80d54c,
+    0x0c81ac79, 0x0c81f553, 0x0c82754d, 0x0c82d54a, 0x0c82f551, 0x0c839532, 0x0c84d54e, 0x0c851552,
+    0x0c858ec0, 0x0c85adcb, 0x0c86954b, 0x0c86d54f, 0x0c874867, 0x0c87c9af, 0x0c884bdb, 0x0c89d557,
+    0x0c8b0d85, 0x0c8cf554, 0x0c8d3000, 0x0c8df555, 0x0c8ed556, 0x0c8f104c, 0x0c8f4ba0, 0x0c906882,
+    0x0c91155d, 0x0c9249d4, 0x0c92755a, 0x0c92b559, 0x0c934e51, 0x0c93cdf3, 0x0c948d90, 0x0c94b55b,
+    0x0c95355c, 0x0c956f4f, 0x0c95ae64, 0x0c95c9c2, 0x0c960bef, 0x0c964fef, 0x0c9726e8, 0x0c977563,
+    0x0c97955e, 0x0c9830a9, 0x0c985565, 0x0c98b561, 0x0c98f562, 0x0c99ac40, 0x0c9a5560, 0x0c9a951e,
+    0x0c9b1564, 0x0c9b555f, 0x0c9c1569, 0x0c9c356a, 0x0c9c4d86, 0x0c9c756c, 0x0c9cc9c3, 0x0c9cf567,
+    0x0c9d879b, 0x0c9df56d, 0x0c9e3566, 0x0c9e5571, 0x0c9e9570, 0x0c9ed56f, 0x0c9f5572, 0x0c9fb574,
+    0x0c9fcb2f, 0x0ca01573, 0x0ca0b577, 0x0ca31575, 0x0ca39576, 0x0ca3b550, 0x0ca47579, 0x0ca49578,
+    0x0ca55558, 0x0ca5757a, 0x0ca5956e, 0x0ca5e9f8, 0x0ca6957b, 0x0ca6b57c, 0x0ca6d57e, 0x0ca6f57d,
+    0x0ca7157f, 0x0ca726bc, 0x0ca76915, 0x0ca7cfba, 0x0ca7ebad, 0x0ca8a8cc, 0x0ca91581, 0x0ca9b584,
+    0x0ca9ef31, 0x0caa27be, 0x0caab583, 0x0caad582, 0x0caaee73, 0x0cab1585, 0x0cab27f3, 0x0cabb587,
+    0x0cabd586, 0x0cac4738, 0x0cac69d5, 0x0cacce16, 0x0cad8868, 0x0cae0b94, 0x0cae5588, 0x0cae8bae,
+    0x0caead87, 0x0caeef3e, 0x0caf1589, 0x0cb0558a, 0x0cb0758b, 0x0cb0ef76, 0x0cb113bc, 0x0cb12bc4,
+    0x0cb18f2b, 0x0cb1c996, 0x0cb20ee3, 0x0cb22ec1, 0x0cb2edac, 0x0cb330ff, 0x0cb3758d, 0x0cb38a4e,
+    0x0cb3f58e, 0x0cb425b4, 0x0cb48812, 0x0cb4abcb, 0x0cb4ef40, 0x0cb5758f, 0x0cb589e1, 0x0cb5ace6,
+    0x0cb5e9fa, 0x0cb60b56, 0x0cb6f590, 0x0cb72fbb, 0x0cb78657, 0x0cb7a9fb, 0x0cb83593, 0x0cb87591,
+    0x0cb89594, 0x0cb8b0f7, 0x0cb8d592, 0x0cb96bf9, 0x0cb99595, 0x0cb9ec70, 0x0cba5596, 0x0cbae778,
+    0x0cbb3598, 0x0cbb7597, 0x0cbc1599, 0x0cbc359a, 0x0cbc4779, 0x0cbcae3a, 0x0cbcccd5, 0x0cbce7cc,
+    0x0cbd09fc, 0x0cbd2c41, 0x0cbd8abb, 0x0cbda5ae, 0x0cbe359b, 0x0cbf4660, 0x0cbf759f, 0x0cc04916,
+    0x0cc0759e, 0x0cc0c969, 0x0cc0eaf8, 0x0cc1559d, 0x0cc18af9, 0x0cc1d03e, 0x0cc1e968, 0x0cc265d5,
+    0x0cc28bcc, 0x0cc395a4, 0x0cc3ebaf, 0x0cc40626, 0x0cc4aab4, 0x0cc4f006, 0x0cc509b0, 0x0cc5aafa,
+    0x0cc5eba5, 0x0cc695a3, 0x0cc6b5a1, 0x0cc6d5a2, 0x0cc78d0b, 0x0cc7f5c5, 0x0cc835a8, 0x0cc84a1e,
+    0x0cc86917, 0x0cc895a6, 0x0cc935a7, 0x0cc96b57, 0x0cc9f5a5, 0x0cca49ce, 0x0ccbb5aa, 0x0ccbd5a9,
+    0x0ccbf5ae, 0x0ccc55af, 0x0ccc95ab, 0x0cccc6c1, 0x0cccf5ac, 0x0ccd15ad, 0x0ccd2ed3, 0x0ccdcf41,
+    0x0ccde869, 0x0cce15b0, 0x0cce8bb0, 0x0ccecafb, 0x0ccf4cf1, 0x0cd02805, 0x0cd075b1, 0x0cd095b5,
+    0x0cd0e689, 0x0cd115b2, 0x0cd135b4, 0x0cd1d5b3, 0x0cd22acb, 0x0cd2cce7, 0x0cd2e5c3, 0x0cd315b6,
+    0x0cd3b5b7, 0x0cd44d28, 0x0cd4d12f, 0x0cd569e2, 0x0cd5cfa9, 0x0cd68fdc, 0x0cd715c1, 0x0cd735b9,
+    0x0cd795bc, 0x0cd7d5bb, 0x0cd835b8, 0x0cd895c0, 0x0cd8ee1c, 0x0cd935ba, 0x0cdad5c2, 0x0cdb2acc,
+    0x0cdb55c3, 0x0cdb90aa, 0x0cdbae98, 0x0cdc15c4, 0x0cdcd5c6, 0x0cdd35c7, 0x0cde15c8, 0x0cde4808,
+    0x0cde6627, 0x0cde8918, 0x0cdeb5c9, 0x0cdef5ca, 0x0cdf0ad1, 0x0cdf2c42, 0x0cdf9296, 0x0cdfac1d,
+    0x0cdfcc1c, 0x0cdfec96, 0x0ce00985, 0x0ce071f0, 0x0ce1088e, 0x0ce1308c, 0x0ce16fbc, 0x0ce1af5e,
+    0x0ce1f5cb, 0x0ce289b1, 0x0ce2ad3d, 0x0ce2d5cc, 0x0ce2f14e, 0x0ce36fdd, 0x0ce3ad29, 0x0ce3d5cd,
+    0x0ce3e77a, 0x0ce4d5ce, 0x0ce4f5cf, 0x0ce51058, 0x0ce55022, 0x0ce57016, 0x0ce58ffb, 0x0ce5a9c4,
+    0x0ce5d5d1, 0x0ce62a69, 0x0ce68ff0, 0x0ce6d5d3, 0x0ce6f5d6, 0x0ce715d5, 0x0ce74777, 0x0ce7a7c0,
+    0x0ce7f5d2, 0x0ce835d4, 0x0ce8d5d7, 0x0ce92b99, 0x0ce9d0db, 0x0ce9e5c7, 0x0cea099e, 0x0cea2c7a,
+    0x0cea6a5b, 0x0ceacb31, 0x0ceb35da, 0x0ceb8dad, 0x0cebd5d8, 0x0cebec69, 0x0cec15d9, 0x0cec2b30,
+    0x0cec505b, 0x0cec75db, 0x0cec95dc, 0x0cecb0c8, 0x0ced55e1, 0x0ceda919, 0x0cedee74, 0x0cee15de,
+    0x0cee2dcc, 0x0cee559c, 0x0cee75a0, 0x0ceea7ae, 0x0ceeee66, 0x0cef95e0, 0x0cefcafc, 0x0cefeec2,
+    0x0cf0b5e6, 0x0cf0eef8, 0x0cf135dd, 0x0cf175e3, 0x0cf195e2, 0x0cf20bcd, 0x0cf2b00d, 0x0cf2f111,
+    0x0cf35007, 0x0cf3868a, 0x0cf3a9fd, 0x0cf41167, 0x0cf435e5, 0x0cf44b95, 0x0cf4d5e4, 0x0cf535df,
+    0x0cf5e8cd, 0x0cf675eb, 0x0cf695e9, 0x0cf6c68b, 0x0cf6f5e7, 0x0cf715ed, 0x0cf735f3, 0x0cf82c86,
+    0x0cf88f7f, 0x0cf8d5f5, 0x0cf94f01, 0x0cf9d5f4, 0x0cf9ee90, 0x0cfa0fde, 0x0cfa2739, 0x0cfa6bf5,
+    0x0cfa8a9f, 0x0cfb0d51, 0x0cfb508d, 0x0cfbb5f0, 0x0cfbd5ef, 0x0cfc55f1, 0x0cfc95ee, 0x0cfcf5f6,
+    0x0cfd35ec, 0x0cfd95ea, 0x0cfdd5f2, 0x0cfdf5e8, 0x0cfe2d0c, 0x0cfe7076, 0x0cfe8a44, 0x0cfea9b2,
+    0x0cff6978, 0x0cffd00f, 0x0cffe6e0, 0x0d004d4c, 0x0d006e08, 0x0d008628, 0x0d026bf0, 0x0d02cbb2,
+    0x0d02e849, 0x0d03d5f8, 0x0d04291a, 0x0d04471c, 0x0d0535fa, 0x0d054714, 0x0d057601, 0x0d0655fd,
+    0x0d068bf1, 0x0d0706ea, 0x0d07296a, 0x0d0786e9, 0x0d07a98d, 0x0d0815fb, 0x0d082885, 0x0d08486a,
+    0x0d086dcd, 0x0d08d5f9, 0x0d0905c4, 0x0d09b5fc, 0x0d09d5fe, 0x0d0a080b, 0x0d0a284b, 0x0d0a673a,
+    0x0d0a87aa, 0x0d0b3602, 0x0d0b89b7, 0x0d0bb011, 0x0d0be9d6, 0x0d0c7603, 0x0d0cef0f, 0x0d0e960f,
+    0x0d0ec671, 0x0d0ef604, 0x0d0fd615, 0x0d0ff605, 0x0d103100, 0x0d10760c, 0x0d10ae7e, 0x0d11b614,
+    0x0d11f607, 0x0d1265b2, 0x0d129609, 0x0d12e91b, 0x0d13760b, 0x0d13b60a, 0x0d13f606, 0x0d141611,
+    0x0d144afd, 0x0d14d36b, 0x0d14e8e6, 0x0d1510dc, 0x0d15b608, 0x0d15ed72, 0x0d1606c2, 0x0d16296b,
+    0x0d167600, 0x0d16b610, 0x0d16c701, 0x0d17360e, 0x0d175612, 0x0d178dce, 0x0d18877c, 0x0d18d630,
+    0x0d193047, 0x0d195617, 0x0d19677b, 0x0d19b61e, 0x0d1a4fdf, 0x0d1a961f, 0x0d1ab621, 0x0d1af625,
+    0x0d1b1619, 0x0d1b4cc9, 0x0d1bedcf, 0x0d1c1629, 0x0d1c361c, 0x0d1c7626, 0x0d1cf620, 0x0d1dcb58,
+    0x0d1df62a, 0x0d1e4bb1, 0x0d1f3628, 0x0d1f473b, 0x0d20116f, 0x0d203616, 0x0d209624, 0x0d20a5d6,
+    0x0d211618, 0x0d217038, 0x0d21961d, 0x0d21ab41, 0x0d21cd45, 0x0d21f613, 0x0d225623, 0x0d232b9a,
+    0x0d23562d, 0x0d236711, 0x0d23889f, 0x0d24362f, 0x0d24561a, 0x0d24762e, 0x0d24b627, 0x0d24d61b,
+    0x0d25162b, 0x0d25562c, 0x0d26163d, 0x0d268e0c, 0x0d26d622, 0x0d273639, 0x0d27b63b, 0x0d27ed56,
+    0x0d2950ab, 0x0d2a6f56, 0x0d2a9636, 0x0d2aac88, 0x0d2b363c, 0x0d2b4c1e, 0x0d2b9633, 0x0d2bb640,
+    0x0d2bd63f, 0x0d2c0e2d, 0x0d2c363e, 0x0d2c4e28, 0x0d2d5642, 0x0d2d7635, 0x0d2da806, 0x0d2dd638,
+    0x0d2deabc, 0x0d2e6e80, 0x0d2e963a, 0x0d2ea809, 0x0d2ef632, 0x0d2f1634, 0x0d2f3631, 0x0d2f914f,
+    0x0d2fa6f9, 0x0d2fd637, 0x0d303641, 0x0d3046d4, 0x0d3149a5, 0x0d31c63c, 0x0d323652, 0x0d329150,
+    0x0d32b655, 0x0d336b59, 0x0d339654, 0x0d341653, 0x0d34f650, 0x0d35d644, 0x0d363661, 0x0d365643,
+    0x0d369656, 0x0d37764e, 0x0d37d649, 0x0d37f646, 0x0d383647, 0x0d38764f, 0x0d38ff20, 0x0d39564c,
+    0x0d39691c, 0x0d398d46, 0x0d39ac44, 0x0d39d64a, 0x0d3a1645, 0x0d3a7648, 0x0d3b10ac, 0x0d3b300a,
+    0x0d3bb64d, 0x0d3bd657, 0x0d3cf65f, 0x0d3d1658, 0x0d3d7665, 0x0d3db663, 0x0d3e565e, 0x0d3f365d,
+    0x0d3f6d4e, 0x0d3fac45, 0x0d3ff65b, 0x0d405659, 0x0d40b660, 0x0d415666, 0x0d416ef3, 0x0d41966c,
+    0x0d425667, 0x0d42766a, 0x0d429664, 0x0d42ed14, 0x0d432f17, 0x0d43765a, 0x0d43d662, 0x0d43eafe,
+    0x0d44304d, 0x0d445676, 0x0d447669, 0x0d4528a0, 0x0d454661, 0x0d4566fe, 0x0d45d651, 0x0d46aaff,
+    0x0d46d66e, 0x0d471675, 0x0d472a77, 0x0d474712, 0x0d47accd, 0x0d48966b, 0x0d48f670, 0x0d491674,
+    0x0d4967f4, 0x0d4b07ab, 0x0d4b3672, 0x0d4be780, 0x0d4c2e09, 0x0d4c5671, 0x0d4cd673, 0x0d4e566d,
+    0x0d4f166f, 0x0d4fe700, 0x0d500ce8, 0x0d50967a, 0x0d51b678, 0x0d51c8e7, 0x0d521677, 0x0d52f680,
+    0x0d5395f7, 0x0d541679, 0x0d54567b, 0x0d54767c, 0x0d55568b, 0x0d559687, 0x0d55d60d, 0x0d567686,
+    0x0d571685, 0x0d577682, 0x0d583668, 0x0d585684, 0x0d587683, 0x0d5a3689, 0x0d5a7145, 0x0d5b568c,
+    0x0d5b6839, 0x0d5bd688, 0x0d5bf68a, 0x0d5d0ea5, 0x0d5d568d, 0x0d5f5691, 0x0d5f768e, 0x0d6090d3,
+    0x0d60b68f, 0x0d61565c, 0x0d625692, 0x0d62d693, 0x0d63a614, 0x0d63f695, 0x0d640887, 0x0d642a1f,
+    0x0d646813, 0x0d64e662, 0x0d6650be, 0x0d66f697, 0x0d671696, 0x0d673699, 0x0d67479c, 0x0d67a814,
+    0x0d67c73c, 0x0d68769c, 0x0d68f69b, 0x0d69369d, 0x0d69868c, 0x0d69ccd6, 0x0d6a169e, 0x0d6a673d,
+    0x0d6a96a0, 0x0d6b369f, 0x0d6b76a1, 0x0d6bf6a2, 0x0d6c36a3, 0x0d6c49fe, 0x0d6c6bb3, 0x0d6c895f,
+    0x0d6ccf50, 0x0d6d2fa0, 0x0d6d5163, 0x0d6dea15, 0x0d6e698e, 0x0d6e9130, 0x0d6f16a4, 0x0d6f36a5,
+    0x0d6f6a00, 0x0d6ff6a6, 0x0d7016a7, 0x0d7076a9, 0x0d7096a8, 0x0d70cff7, 0x0d712abd, 0x0d714a6a,
+    0x0d7169e3, 0x0d71b6aa, 0x0d72b6ac, 0x0d72cb42, 0x0d7316ab, 0x0d73d6ad, 0x0d7496ae, 0x0d7556af,
+    0x0d7576b0, 0x0d75f6b1, 0x0d7636b3, 0x0d7656b2, 0x0d7676b4, 0x0d768663, 0x0d76ace9, 0x0d76f6b5,
+    0x0d7749c5, 0x0d7766eb, 0x0d7796b6, 0x0d77eda1, 0x0d78134a, 0x0d78a782, 0x0d78d6b7, 0x0d7976b8,
+    0x0d79afaa, 0x0d79d008, 0x0d7a4e05, 0x0d7a76b9, 0x0d7a8ee4, 0x0d7b0ef9, 0x0d7b7051, 0x0d7bf6ba,
+    0x0d7d76bc, 0x0d7d96bb, 0x0d7df6be, 0x0d7e76bd, 0x0d8116c1, 0x0d81ea01, 0x0d82302f, 0x0d8276c2,
+    0x0d8296c3, 0x0d82e783, 0x0d8376c4, 0x0d8476c6, 0x0d8496c5, 0x0d868b85, 0x0d86ef18, 0x0d870629,
+    0x0d87cec3, 0x0d880d73, 0x0d882aa0, 0x0d8847c1, 0x0d89cec4, 0x0d8a0a2c, 0x0d8ab6c8, 0x0d8ae73e,
+    0x0d8b4658, 0x0d8bae30, 0x0d8bd6c7, 0x0d8be91d, 0x0d8c0cf2, 0x0d8c56c9, 0x0d8d16d1, 0x0d8d56ca,
+    0x0d8e0c7f, 0x0d8e47c2, 0x0d8e76d2, 0x0d8f4888, 0x0d8fa784, 0x0d8fd6d0, 0x0d9036ce, 0x0d9056cb,
+    0x0d9070c0, 0x0d910d3e, 0x0d918e17, 0x0d91b6cc, 0x0d9216d4, 0x0d9256d3, 0x0d926842, 0x0d92c66b,
+    0x0d932979, 0x0d9356cd, 0x0d9376cf, 0x0d942ff6, 0x0d944cb2, 0x0d957017, 0x0d95d6dc, 0x0d9636dd,
+    0x0d96668d, 0x0d970f66, 0x0d97307b, 0x0d9756df, 0x0d976a21, 0x0d978b00, 0x0d97b6d8, 0x0d97d6de,
+    0x0d97e648, 0x0d9827f5, 0x0d9896d5, 0x0d98b6da, 0x0d992bf2, 0x0d994e91, 0x0d998ee5, 0x0d9a76d7,
+    0x0d9aafc0, 0x0d9af6d9, 0x0d9b36e2, 0x0d9b76e0, 0x0d9bb6db, 0x0d9c2fc1, 0x0d9c4e67, 0x0d9c67c3,
+    0x0d9cad84, 0x0d9d0d0d, 0x0d9d56e3, 0x0d9df6e1, 0x0d9e0c97, 0x0d9e36d6, 0x0d9e662a, 0x0da170ad,
+    0x0da196ee, 0x0da256ed, 0x0da2ebf4, 0x0da336ea, 0x0da370cc, 0x0da3cdf4, 0x0da3f6e4, 0x0da4ad43,
+    0x0da5262b, 0x0da5491e, 0x0da576e7, 0x0da64a86, 0x0da676ec, 0x0da6b6eb, 0x0da6d6e6, 0x0da716e9,
+    0x0da76708, 0x0da7b6e8, 0x0da7ce68, 0x0da830ec, 0x0da88b32, 0x0da8abf3, 0x0dab36f4, 0x0dab56f2,
+    0x0dab8f2c, 0x0dac76ef, 0x0dac96f1, 0x0dacc619, 0x0dad291f, 0x0dad5151, 0x0dad86dc, 0x0dadcf42,
+    0x0dae90c1, 0x0daee6c3, 0x0daf0b5a, 0x0daf36f3, 0x0db0b6f8, 0x0db10b01, 0x0db1908f, 0x0db1d6f5,
+    0x0db276f0, 0x0db2b6f6, 0x0db3311c, 0x0db36dd3, 0x0db38e00, 0x0db5e6d5, 0x0db64634, 0x0db6b6fc,
+    0x0db716ff, 0x0db79101, 0x0db810c4, 0x0db8b706, 0x0db8d700, 0x0db8f6fd, 0x0db97112, 0x0db99703,
+    0x0dba2aa9, 0x0dba5705, 0x0dbab70a, 0x0dbb0dd1, 0x0dbb3708, 0x0dbbd702, 0x0dbc2cd7, 0x0dbc9709,
+    0x0dbcd6fe, 0x0dbd1704, 0x0dbd570b, 0x0dbd65fa, 0x0dbd9701, 0x0dbdd70c, 0x0dbe2b5b, 0x0dbe6abe,
+    0x0dbeaf63, 0x0dbee96c, 0x0dbf36f9, 0x0dbf5707, 0x0dbf6d99, 0x0dc0abb4, 0x0dc0e709, 0x0dc1098f,
+    0x0dc12b02, 0x0dc156fb, 0x0dc16aa1, 0x0dc2686b, 0x0dc2b6fa, 0x0dc33710, 0x0dc34acd, 0x0dc368b8,
+    0x0dc3b71f, 0x0dc3f719, 0x0dc407d4, 0x0dc42dae, 0x0dc47714, 0x0dc4971d, 0x0dc4a5ad, 0x0dc4c611,
+    0x0dc52677, 0x0dc57716, 0x0dc58c6a, 0x0dc5b70d, 0x0dc5d70f, 0x0dc5e920, 0x0dc71720, 0x0dc7571b,
+    0x0dc7d713, 0x0dc8771a, 0x0dc95029, 0x0dc9b718, 0x0dc9d71c, 0x0dcac8ce, 0x0dcb0b03, 0x0dcb6cd8,
+    0x0dcbf712, 0x0dccf08e, 0x0dcd7715, 0x0dcdd70e, 0x0dcdedd2, 0x0dce5711, 0x0dced717, 0x0dcfd170,
+    0x0dcfea3c, 0x0dd0101e, 0x0dd05721, 0x0dd18eac, 0x0dd1f72d, 0x0dd208b9, 0x0dd2cac0, 0x0dd31723,
+    0x0dd390ed, 0x0dd3a921, 0x0dd3f730, 0x0dd445ec, 0x0dd4b72e, 0x0dd55722, 0x0dd5f728, 0x0dd6572a,
+    0x0dd6d0ae, 0x0dd6f725, 0x0dd74d8d, 0x0dd7b727, 0x0dd8572f, 0x0dd89729, 0x0dd8b045, 0x0dd93724,
+    0x0dd96a20, 0x0dd9973c, 0x0dda270a, 0x0dda7726, 0x0dda972b, 0x0ddab72c, 0x0ddbacaa, 0x0ddbcc98,
+    0x0ddd9734, 0x0dddf73a, 0x0dde5738, 0x0dde8d88, 0x0ddef742, 0x0ddf1735, 0x0ddfd736, 0x0ddff71e,
+    0x0de027d9, 0x0de04f19, 0x0de0ca3d, 0x0de12957, 0x0de1f152, 0x0de23732, 0x0de27741, 0x0de28649,
+    0x0de2ac46, 0x0de40e99, 0x0de4473f, 0x0de47138, 0x0de5701f, 0x0de58d50, 0x0de63739, 0x0de6573b,
+    0x0de70c11, 0x0de7d740, 0x0de7f737, 0x0de83731, 0x0de8a741, 0x0dea8889, 0x0deb174e, 0x0deb7749,
+    0x0deb8bf6, 0x0debe703, 0x0dec8ac1, 0x0decd752, 0x0dedb74b, 0x0dedcd2a, 0x0dedf748, 0x0dee0d57,
+    0x0dee976b, 0x0def1745, 0x0def5744, 0x0def974d, 0x0df01747, 0x0df03746, 0x0df0574c, 0x0df08b9f,
+    0x0df0d743, 0x0df1d74f, 0x0df23750, 0x0df2e740, 0x0df43755, 0x0df47754, 0x0df49756, 0x0df55759,
+    0x0df62da2, 0x0df67753, 0x0df73757, 0x0df80883, 0x0df82cb7, 0x0df85751, 0x0df86e5a, 0x0df8d758,
+    0x0dfa975d, 0x0dfab75b, 0x0dfb175e, 0x0dfb7761, 0x0dfbf75a, 0x0dfc094a, 0x0dfc2e47, 0x0dfc96f7,
+    0x0dfd70d4, 0x0dfd975c, 0x0dfdd760, 0x0dfdecb3, 0x0dfe375f, 0x0dfe774a, 0x0dfedd89, 0x0dff5764,
+    0x0dffd768, 0x0e003766, 0x0e013762, 0x0e017763, 0x0e01f767, 0x0e023765, 0x0e02af2d, 0x0e03176d,
+    0x0e03576a, 0x0e037769, 0x0e03b76c, 0x0e03ce12, 0x0e03f76e, 0x0e04cd15, 0x0e04ecab, 0x0e058ba3,
+    0x0e06176f, 0x0e065771, 0x0e07d770, 0x0e099733, 0x0e0a3772, 0x0e0b0e25, 0x0e0c7773, 0x0e0d668e,
+    0x0e0dedd4, 0x0e0e06c4, 0x0e0f07c4, 0x0e0f8a5c, 0x0e0fa990, 0x0e113146, 0x0e114b86, 0x0e11c64a,
+    0x0e125775, 0x0e133774, 0x0e159778, 0x0e15acd9, 0x0e15d77b, 0x0e15f776, 0x0e16777a, 0x0e171779,
+    0x0e172d9f, 0x0e1745d7, 0x0e191133, 0x0e19777d, 0x0e19e607, 0x0e1b3780, 0x0e1bb77e, 0x0e1bf77c,
+    0x0e1e3777, 0x0e1f2fc2, 0x0e1fb782, 0x0e213781, 0x0e22864b, 0x0e233784, 0x0e234f70, 0x0e239783,
+    0x0e243033, 0x0e24cb05, 0x0e26cc12, 0x0e278b04, 0x0e293139, 0x0e29978a, 0x0e29cbf7, 0x0e2ab786,
+    0x0e2ad78b, 0x0e2b264c, 0x0e2c5789, 0x0e2c8e81, 0x0e2cb785, 0x0e2cd788, 0x0e2ceb06, 0x0e2d2ecf,
+    0x0e2d978c, 0x0e2dca4f, 0x0e2fabf8, 0x0e30978f, 0x0e311787, 0x0e314846, 0x0e31f78d, 0x0e3290af,
+    0x0e32b790, 0x0e333f24, 0x0e33eaae, 0x0e351791, 0x0e359792, 0x0e362e4d, 0x0e373794, 0x0e37d795,
+    0x0e386e52, 0x0e390dd5, 0x0e393797, 0x0e39d799, 0x0e3a1113, 0x0e3a5796, 0x0e3a9798, 0x0e3aa64d,
+    0x0e3af793, 0x0e3bf2fa, 0x0e3c179a, 0x0e3cac47, 0x0e3cc9d7, 0x0e3cf79c, 0x0e3d979b, 0x0e3dab43,
+    0x0e3dd297, 0x0e3eb79d, 0x0e3f379f, 0x0e3f778e, 0x0e3f979e, 0x0e3ff7a0, 0x0e40ce9a, 0x0e41b7a1,
+    0x0e4217a2, 0x0e4377a3, 0x0e4517a4, 0x0e454d5c, 0x0e4597a6, 0x0e45b7a5, 0x0e4617a7, 0x0e4657a8,
+    0x0e46aa5d, 0x0e46cf43, 0x0e47506a, 0x0e4777a9, 0x0e4797aa, 0x0e47ac35, 0x0e47ca22, 0x0e47f7ab,
+    0x0e4817ac, 0x0e48d7ad, 0x0e48ef90, 0x0e490ec5, 0x0e4977ae, 0x0e498e76, 0x0e4a4d2b, 0x0e4b17af,
+    0x0e4b26a5, 0x0e4b67cd, 0x0e4bb044, 0x0e4bf034, 0x0e4c2672, 0x0e4c5153, 0x0e4ceff1, 0x0e4d2f68,
+    0x0e4e4bb5, 0x0e4e97b0, 0x0e4f2e01, 0x0e4fa8a1, 0x0e4fd7b1, 0x0e500992, 0x0e5037b3, 0x0e5057b2,
+    0x0e50f7b4, 0x0e5257b5, 0x0e52d7b6, 0x0e54079d, 0x0e5457b7, 0x0e54f7b8, 0x0e5588a2, 0x0e55eec6,
+    0x0e5657ba, 0x0e56cb33, 0x0e5737b9, 0x0e5847f6, 0x0e5877bb, 0x0e5897bd, 0x0e58d7bc, 0x0e59d7be,
+    0x0e5a08cf, 0x0e5a57bf, 0x0e5ae827, 0x0e5b2c1f, 0x0e5b695d, 0x0e5c17c1, 0x0e5c37c2, 0x0e5c57c0,
+    0x0e5d2a6b, 0x0e5d8e06, 0x0e5da7f7, 0x0e5ef7c4, 0x0e5f0ccb, 0x0e5f37c3, 0x0e5f9154, 0x0e5fae82,
+    0x0e6157c7, 0x0e62d7c9, 0x0e62f7c6, 0x0e637052, 0x0e6397c8, 0x0e63b7ca, 0x0e63f102, 0x0e64b7ce,
+    0x0e6537cd, 0x0e654d16, 0x0e656e4c, 0x0e65c8a3, 0x0e65f7cc, 0x0e6697cb, 0x0e66d090, 0x0e66f091,
+    0x0e67d7cf, 0x0e67e64e, 0x0e688956, 0x0e68aa02, 0x0e69d7d0, 0x0e69f7d1, 0x0e6af7d3, 0x0e6c6aa2,
+    0x0e6d17d5, 0x0e6d57d4, 0x0e6e17d6, 0x0e6e46ec, 0x0e6eb7d8, 0x0e6f17d7, 0x0e6f57da, 0x0e6f77d9,
+    0x0e7088ba, 0x0e70f0e6, 0x0e71280a, 0x0e716664, 0x0e72c828, 0x0e75275f, 0x0e765126, 0x0e7677dc,
+    0x0e7777de, 0x0e7817df, 0x0e78468f, 0x0e7917db, 0x0e7949d8, 0x0e79ad3f, 0x0e79d7dd, 0x0e7bd7e2,
+    0x0e7c0a6c, 0x0e7cb7e0, 0x0e7d485d, 0x0e7daec7, 0x0e7dd7e1, 0x0e7e37fc, 0x0e7f17e7, 0x0e7fc8bb,
+    0x0e8067c5, 0x0e80b7e4, 0x0e80d0dd, 0x0e8130ee, 0x0e844cb4, 0x0e84b7e6, 0x0e8657e8, 0x0e867114,
+    0x0e868815, 0x0e86aefa, 0x0e86ce69, 0x0e8757e9, 0x0e87f7eb, 0x0e8837ee, 0x0e8ab7ea, 0x0e8b37ed,
+    0x0e8b48e8, 0x0e8b662c, 0x0e8b97ef, 0x0e8bcb90, 0x0e8bf7ec, 0x0e8c111a, 0x0e8c77f2, 0x0e8c9f22,
+    0x0e8d37f0, 0x0e8d57f3, 0x0e8df7e5, 0x0e8e17f1, 0x0e8e697a, 0x0e8ed7f4, 0x0e8fd7f5, 0x0e9070de,
+    0x0e9177f6, 0x0e93d7f7, 0x0e9457e3, 0x0e94f7f8, 0x0e960742, 0x0e97aa23, 0x0e9957f9, 0x0e99f7fa,
+    0x0e9a97fb, 0x0e9b861a, 0x0e9c1800, 0x0e9c4f1a, 0x0e9c7801, 0x0e9cc722, 0x0e9cf802, 0x0e9d3803,
+    0x0e9dd804, 0x0e9e1806, 0x0e9e3807, 0x0e9e5805, 0x0e9ecf32, 0x0e9ef809, 0x0e9f1808, 0x0ea0780b,
+    0x0ea0980a, 0x0ea0b80c, 0x0ea1980d, 0x0ea1b80f, 0x0ea1d80e, 0x0ea22959, 0x0ea27811, 0x0ea2b810,
+    0x0ea30743, 0x0ea34b72, 0x0ea38d9b, 0x0ea3d812, 0x0ea3ebb6, 0x0ea469d9, 0x0ea4a659, 0x0ea4d813,
+    0x0ea510b0, 0x0ea56fa1, 0x0ea59814, 0x0ea60da3, 0x0ea63092, 0x0ea64922, 0x0ea66b5c, 0x0ea6ecea,
+    0x0ea71272, 0x0ea74d2c, 0x0ea766a6, 0x0ea79815, 0x0ea89816, 0x0ea8d81b, 0x0ea93819, 0x0ea95818,
+    0x0ea97580, 0x0ea986c5, 0x0ea9b817, 0x0ea9e5d8, 0x0eaa2ea8, 0x0eaa8ec8, 0x0eab30ef, 0x0eab581c,
+    0x0eab781a, 0x0eab8cfb, 0x0eababa4, 0x0eac0ea9, 0x0eac4f0c, 0x0eac981e, 0x0eacb0ea, 0x0eacc86c,
+    0x0eacf81f, 0x0ead381d, 0x0ead4ed4, 0x0ead7820, 0x0eadb821, 0x0eae05d9, 0x0eae6b34, 0x0eae9826,
+    0x0eaed823, 0x0eaeee2b, 0x0eaf1822, 0x0eafe785, 0x0eb05829, 0x0eb0d824, 0x0eb0f825, 0x0eb13828,
+    0x0eb15827, 0x0eb16f04, 0x0eb1cc21, 0x0eb1ec20, 0x0eb2279e, 0x0eb2982a, 0x0eb3582b, 0x0eb3b82c,
+    0x0eb4782e, 0x0eb4b82d, 0x0eb56635, 0x0eb63836, 0x0eb64ee6, 0x0eb67830, 0x0eb6b832, 0x0eb71834,
+    0x0eb72b5d, 0x0eb79835, 0x0eb7b833, 0x0eb7ca3e, 0x0eb8582f, 0x0eb87831, 0x0eb8af21, 0x0eb8eb07,
+    0x0eb95838, 0x0eb9b837, 0x0eba5839, 0x0eba8a24, 0x0ebaa96d, 0x0ebb0dd7, 0x0ebb383a, 0x0ebb6d49,
+    0x0ebbd83c, 0x0ebc50df, 0x0ebc783b, 0x0ebd2c49, 0x0ebe1842, 0x0ebe5844, 0x0ebe7845, 0x0ebe8cf3,
+    0x0ebf5843, 0x0ebf9840, 0x0ebfd83d, 0x0ebff83e, 0x0ec03841, 0x0ec13848, 0x0ec17846, 0x0ec1b847,
+    0x0ec3f849, 0x0ec4184b, 0x0ec4384c, 0x0ec4584d, 0x0ec4984e, 0x0ec4f84a, 0x0ec61850, 0x0ec6984f,
+    0x0ec77851, 0x0ec85103, 0x0ec8d854, 0x0ec8f852, 0x0ec91853, 0x0ec98760, 0x0eca507c, 0x0ecacf88,
+    0x0ecb1856, 0x0ecb9855, 0x0ecc3857, 0x0ecc5858, 0x0eccf85c, 0x0ecd1859, 0x0ecd385a, 0x0ecd585b,
+    0x0ecd985d, 0x0ece185e, 0x0ece585f, 0x0eced860, 0x0ecf1861, 0x0ecf4ead, 0x0ecf6daf, 0x0ecf9862,
+    0x0ecfae92, 0x0ecfcf13, 0x0ed01863, 0x0ed07864, 0x0ed08d89, 0x0ed0c6c6, 0x0ed0e923, 0x0ed11865,
+    0x0ed17866, 0x0ed1d867, 0x0ed209c8, 0x0ed27869, 0x0ed2d868, 0x0ed3386a, 0x0ed3586b, 0x0ed5cee7,
+    0x0ed6186c, 0x0ed6986d, 0x0ed6ff09, 0x0ed7186e, 0x0ed7386f, 0x0ed75870, 0x0ed7e9cd, 0x0ed85871,
+    0x0ed86e75, 0x0ed8cffe, 0x0ed9062d, 0x0ed94636, 0x0ed9b872, 0x0eda5874, 0x0edad873, 0x0edaedd0,
+    0x0edb6bb7, 0x0edb9698, 0x0edbd875, 0x0edbf03f, 0x0edc3876, 0x0edc6744, 0x0edc8ed5, 0x0edcb877,
+    0x0edcf878, 0x0edd5879, 0x0eddd05a, 0x0ede5053, 0x0ede8d3c, 0x0edf0c4a, 0x0edf787b, 0x0edfcac2,
+    0x0ee02b08, 0x0ee0987e, 0x0ee0f87d, 0x0ee1187c, 0x0ee12efb, 0x0ee16745, 0x0ee188a7, 0x0ee37884,
+    0x0ee3d881, 0x0ee3eb5e, 0x0ee41030, 0x0ee49880, 0x0ee4b882, 0x0ee4d883, 0x0ee5387f, 0x0ee6f885,
+    0x0ee71886, 0x0ee74d2d, 0x0ee78761, 0x0ee80d05, 0x0ee8f887, 0x0eeb5888, 0x0eeb788b, 0x0eec2b87,
+    0x0eec6e02, 0x0eecb88c, 0x0eeccff2, 0x0eed1889, 0x0eed788a, 0x0eef388f, 0x0eefd88e, 0x0eeff88d,
+    0x0ef17891, 0x0ef1d890, 0x0ef23892, 0x0ef3d894, 0x0ef41893, 0x0ef4af8b, 0x0ef58ab5, 0x0ef5b104,
+    0x0ef61895, 0x0ef66df5, 0x0ef6d896, 0x0ef73897, 0x0ef7789b, 0x0ef79899, 0x0ef7b89a, 0x0ef7f898,
+    0x0ef8f89c, 0x0ef9b89d, 0x0efaf89e, 0x0efb589f, 0x0efb7035, 0x0efb98a0, 0x0efc506e, 0x0efc78a1,
+    0x0efcaced, 0x0efcee8a, 0x0efd2829, 0x0efdacda, 0x0efdd8a2, 0x0efde7f8, 0x0efe6bce, 0x0eff98a3,
+    0x0f00497b, 0x0f0198a4, 0x0f0258a5, 0x0f0288a4, 0x0f02a993, 0x0f0418a7, 0x0f04adb5, 0x0f04c994,
+    0x0f04e7ad, 0x0f064fc3, 0x0f068e6a, 0x0f074db6, 0x0f07e93b, 0x0f08b8a9, 0x0f0bab09, 0x0f0d70f0,
+    0x0f0d8924, 0x0f0de8a5, 0x0f0e4ea1, 0x0f0e98ab, 0x0f0f98ad, 0x0f1028e9, 0x0f10d8ac, 0x0f10ed74,
+    0x0f1198af, 0x0f11a6d6, 0x0f11d8aa, 0x0f122ee8, 0x0f12660f, 0x0f12a9aa, 0x0f12f171, 0x0f1358ae,
+    0x0f1478b0, 0x0f14ef89, 0x0f152bd7, 0x0f1558b2, 0x0f15f8b3, 0x0f16b8b1, 0x0f1746ed, 0x0f1798b9,
+    0x0f17d8b8, 0x0f182a25, 0x0f18b8ba, 0x0f18d8b5, 0x0f1958bb, 0x0f1978b6, 0x0f1a0ed6, 0x0f1a38b4,
+    0x0f1a98b7, 0x0f1b58c1, 0x0f1cf8c0, 0x0f1d1001, 0x0f1d98bc, 0x0f1de5e9, 0x0f1e98c3, 0x0f1fb8c2,
+    0x0f202b0a, 0x0f20f8c4, 0x0f21cc22, 0x0f2238c6, 0x0f2258c5, 0x0f2338c7, 0x0f24d8a6, 0x0f2558a8,
+    0x0f2578c9, 0x0f2598c8, 0x0f274a26, 0x0f279127, 0x0f27ca50, 0x0f2818ca, 0x0f282856, 0x0f28e79f,
+    0x0f290786, 0x0f292a03, 0x0f2a1093, 0x0f2a78d0, 0x0f2ab8cf, 0x0f2acc23, 0x0f2af8cc, 0x0f2b58ce,
+    0x0f2baaaa, 0x0f2bcb5f, 0x0f2bf8cd, 0x0f2c18cb, 0x0f2c4e49, 0x0f2cab0b, 0x0f2d0f1b, 0x0f2da995,
+    0x0f2eedd8, 0x0f2f58d1, 0x0f2ff8d2, 0x0f3018e8, 0x0f302816, 0x0f30915c, 0x0f30ac14, 0x0f3158d3,
+    0x0f31a690, 0x0f31cd75, 0x0f31ef5f, 0x0f33b8d4, 0x0f34c7da, 0x0f34f8d5, 0x0f3558d7, 0x0f35d8d8,
+    0x0f360e48, 0x0f3678d9, 0x0f3738da, 0x0f3758db, 0x0f37a817, 0x0f37c691, 0x0f37ee03, 0x0f380a87,
+    0x0f382a04, 0x0f3938dc, 0x0f396a88, 0x0f3a2688, 0x0f3a4f22, 0x0f3ab8dd, 0x0f3b0ee9, 0x0f3bec24,
+    0x0f3c38e0, 0x0f3c78e1, 0x0f3c8e89, 0x0f3ccb60, 0x0f3cf8de, 0x0f3d2d01, 0x0f3d98df, 0x0f3e0b0c,
+    0x0f3f65da, 0x0f400788, 0x0f4118e2, 0x0f416d76, 0x0f41b8e3, 0x0f41cbc5, 0x0f42902b, 0x0f42ef02,
+    0x0f4318e4, 0x0f4338e5, 0x0f434cf4, 0x0f439105, 0x0f43f8e7, 0x0f4418e6, 0x0f45ca6d, 0x0f4638e9,
+    0x0f4645ee, 0x0f46f8ec, 0x0f4778ea, 0x0f478692, 0x0f47a86d, 0x0f47d8eb, 0x0f47e925, 0x0f480952,
+    0x0f484fa4, 0x0f4878ed, 0x0f48cff3, 0x0f4938ef, 0x0f49abcf, 0x0f49c62e, 0x0f49e678, 0x0f4a05aa,
+    0x0f4af8ee, 0x0f4c38f0, 0x0f4c58f1, 0x0f4c6b35, 0x0f4d38f2, 0x0f4d66ee, 0x0f4e18f4, 0x0f4e888a,
+    0x0f4ec7c6, 0x0f4f38f5, 0x0f4f4833, 0x0f4fb8f6, 0x0f4febfa, 0x0f502e0b, 0x0f506bde, 0x0f5089b3,
+    0x0f5118f7, 0x0f524d02, 0x0f526c4b, 0x0f52b8f9, 0x0f52d8fb, 0x0f52f8f8, 0x0f5318fa, 0x0f53e841,
+    0x0f5538fc, 0x0f554845, 0x0f55c7c7, 0x0f55f0b1, 0x0f5618fe, 0x0f56d900, 0x0f57460d, 0x0f57f903,
+    0x0f586716, 0x0f589902, 0x0f58b901, 0x0f58f905, 0x0f5918fd, 0x0f595906, 0x0f5970e7, 0x0f59b907,
+    0x0f59f908, 0x0f5a5372, 0x0f5a790a, 0x0f5ab909, 0x0f5b390b, 0x0f5b590c, 0x0f5b90f3, 0x0f5bb90d,
+    0x0f5bfded, 0x0f5c0b0d, 0x0f5c390e, 0x0f5c590f, 0x0f5c6ab6, 0x0f5cadf6, 0x0f5cd910, 0x0f5d4cc7,
+    0x0f5db911, 0x0f5decdb, 0x0f5e1912, 0x0f5ec7e3, 0x0f5f121e, 0x0f5f2cfc, 0x0f5f4a31, 0x0f5fe746,
+    0x0f605913, 0x0f609920, 0x0f60d916, 0x0f6107c8, 0x0f615915, 0x0f617922, 0x0f61f914, 0x0f622b0e,
+    0x0f631918, 0x0f633919, 0x0f636d8a, 0x0f63d91a, 0x0f6406fd, 0x0f64ab79, 0x0f64cf44, 0x0f65191c,
+    0x0f658ca6, 0x0f667917, 0x0f66b91b, 0x0f66d91d, 0x0f6729b9, 0x0f68b924, 0x0f68cf0d, 0x0f690ea4,
+    0x0f692dd9, 0x0f696818, 0x0f699923, 0x0f69b921, 0x0f69eeb3, 0x0f6a191e, 0x0f6a2cfd, 0x0f6a4ddb,
+    0x0f6a8dda, 0x0f6ac9b4, 0x0f6bb936, 0x0f6cb926, 0x0f6cf928, 0x0f6d992b, 0x0f6dd92c, 0x0f6e1929,
+    0x0f6e392a, 0x0f6e9927, 0x0f6eb925, 0x0f6f591f, 0x0f70cf8d, 0x0f70e693, 0x0f717933, 0x0f71b930,
+    0x0f71f935, 0x0f725934, 0x0f728e93, 0x0f72b025, 0x0f72e9da, 0x0f73192e, 0x0f733937, 0x0f735932,
+    0x0f739931, 0x0f73b92d, 0x0f73f92f, 0x0f742747, 0x0f754cdc, 0x0f75abfb, 0x0f762ea0, 0x0f76993c,
+    0x0f770ea2, 0x0f780bdf, 0x0f783939, 0x0f788ecd, 0x0f78d93d, 0x0f78ef91, 0x0f792cfa, 0x0f797938,
+    0x0f79993a, 0x0f79f93b, 0x0f7bb93e, 0x0f7c0a42, 0x0f7c8e04, 0x0f7cb943, 0x0f7cd942, 0x0f7d393f,
+    0x0f7db155, 0x0f7e7948, 0x0f7ed94c, 0x0f7ef949, 0x0f801945, 0x0f80f946, 0x0f81b94b, 0x0f823940,
+    0x0f825293, 0x0f827947, 0x0f829941, 0x0f82f94a, 0x0f83f950, 0x0f842748, 0x0f84794d, 0x0f84f94e,
+    0x0f85594f, 0x0f857952, 0x0f86f951, 0x0f870ef4, 0x0f87b953, 0x0f87d13a, 0x0f87efab, 0x0f881958,
+    0x0f887955, 0x0f899954, 0x0f89abd0, 0x0f89f957, 0x0f8a1959, 0x0f8a9956, 0x0f8ad95d, 0x0f8b195a,
+    0x0f8bf95b, 0x0f8c1944, 0x0f8c995c, 0x0f8cb95e, 0x0f8d995f, 0x0f8e6f84, 0x0f8eb960, 0x0f8fd060,
+    0x0f90280c, 0x0f904848, 0x0f907961, 0x0f912f72, 0x0f916b88, 0x0f91b02e, 0x0f921962, 0x0f9250f1,
+    0x0f92ae94, 0x0f92ec25, 0x0f930e53, 0x0f936aac, 0x0f93e5be, 0x0f943967, 0x0f945965, 0x0f949963,
+    0x0f94a71f, 0x0f94eb0f, 0x0f951968, 0x0f957966, 0x0f95b964, 0x0f95d96c, 0x0f96396b, 0x0f96596a,
+    0x0f967969, 0x0f97396d, 0x0f97b96e, 0x0f97cbb8, 0x0f98196f, 0x0f985971, 0x0f98b970, 0x0f9948d0,
+    0x0f99cc17, 0x0f9a5973, 0x0f9acddc, 0x0f9b1972, 0x0f9b9974, 0x0f9bcf73, 0x0f9bec4c, 0x0f9c0926,
+    0x0f9c5975, 0x0f9cf106, 0x0f9df977, 0x0f9e5978, 0x0f9e9979, 0x0f9ed97a, 0x0f9f0a05, 0x0f9f597b,
+    0x0f9f686e, 0x0f9fc7ca, 0x0fa00789, 0x0fa05980, 0x0fa09071, 0x0fa0a927, 0x0fa0d97c, 0x0fa15983,
+    0x0fa17064, 0x0fa1ae5b, 0x0fa20f12, 0x0fa28ac3, 0x0fa2b982, 0x0fa2ea51, 0x0fa30928, 0x0fa32a06,
+    0x0fa347c9, 0x0fa36f74, 0x0fa39981, 0x0fa40c26, 0x0fa42fe1, 0x0fa449b5, 0x0fa56a07, 0x0fa58d5b,
+    0x0fa5d986, 0x0fa5f11d, 0x0fa60997, 0x0fa65987, 0x0fa66b61, 0x0fa6b989, 0x0fa72b10, 0x0fa7496e,
+    0x0fa7f988, 0x0fa84a89, 0x0fa868bc, 0x0fa88c27, 0x0fa8b984, 0x0fa8d98a, 0x0fa97985, 0x0fa9886f,
+    0x0fa9d98d, 0x0fa9f991, 0x0faa088b, 0x0faad98c, 0x0fab7995, 0x0fabc929, 0x0fac30cd, 0x0fac45ba,
+    0x0fac7992, 0x0facc7cb, 0x0fad198f, 0x0fadd990, 0x0fae2ddd, 0x0fae598e, 0x0fae798b, 0x0faea6c7,
+    0x0faecbe2, 0x0faf28a6, 0x0fafb997, 0x0fb13994, 0x0fb1f996, 0x0fb27993, 0x0fb32870, 0x0fb34c71,
+    0x0fb37998, 0x0fb38c4e, 0x0fb3f9a5, 0x0fb459a1, 0x0fb4799b, 0x0fb5799f, 0x0fb58a78, 0x0fb5a5db,
+    0x0fb5d99a, 0x0fb5f9a2, 0x0fb619a6, 0x0fb6292a, 0x0fb65054, 0x0fb68d54, 0x0fb6b99c, 0x0fb719a4,
+    0x0fb75999, 0x0fb76cdd, 0x0fb7b99e, 0x0fb7c5bb, 0x0fb7f048, 0x0fb8f99d, 0x0fb94819, 0x0fb96eea,
+    0x0fb9ec4d, 0x0fba310e, 0x0fba4acf, 0x0fbab9ce, 0x0fbb19a7, 0x0fbb4bfc, 0x0fbb99a3, 0x0fbbb9a8,
+    0x0fbbd9aa, 0x0fbc0d77, 0x0fbc39ad, 0x0fbc99a9, 0x0fbd0f92, 0x0fbd2749, 0x0fbd9049, 0x0fbde5dc,
+    0x0fbe59ac, 0x0fbe913b, 0x0fbf79ab, 0x0fc0264f, 0x0fc08e2a, 0x0fc0b9ae, 0x0fc139b5, 0x0fc159af,
+    0x0fc179b6, 0x0fc259b2, 0x0fc36e9b, 0x0fc3ca48, 0x0fc3f9b4, 0x0fc439b1, 0x0fc459b7, 0x0fc479b0,
+    0x0fc4caa3, 0x0fc56fc4, 0x0fc5caab, 0x0fc639b3, 0x0fc659c0, 0x0fc6b9bb, 0x0fc6f9be, 0x0fc739bc,
+    0x0fc759c1, 0x0fc779ba, 0x0fc7b9a0, 0x0fc7cbd1, 0x0fc82ec9, 0x0fc879bd, 0x0fc8d9b8, 0x0fc94c00,
+    0x0fc96871, 0x0fc9aa8a, 0x0fca8b44, 0x0fcaac15, 0x0fcad9c4, 0x0fcb39c6, 0x0fcb59c7, 0x0fcbb9c3,
+    0x0fcbd9c5, 0x0fccd9b9, 0x0fccf9c2, 0x0fcd39ca, 0x0fcd59c9, 0x0fcdb01a, 0x0fce084a, 0x0fcf39c8,
+    0x0fcf79cc, 0x0fcf99cb, 0x0fcfb9cf, 0x0fcff9d1, 0x0fd049db, 0x0fd079cd, 0x0fd119d2, 0x0fd139d3,
+    0x0fd199d4, 0x0fd1d9da, 0x0fd1ed9a, 0x0fd219d6, 0x0fd259d5, 0x0fd279d7, 0x0fd299d8, 0x0fd2d9d9,
+    0x0fd379db, 0x0fd399dc, 0x0fe6c74a, 0x0fe719dd, 0x0fe759de, 0x0fe8b9df, 0x0fe999e0, 0x0fe9b9e1,
+    0x0fe9d9e2, 0x0fea19e3, 0x0fea39e4, 0x0fea99e6, 0x0feab9e5, 0x0feb19e7, 0x0febf9e8, 0x0fec19e9,
+    0x0fecf9ec, 0x0fed19ea, 0x0fed39eb, 0x0fed499f, 0x0fed6872, 0x0fedccf5, 0x0fee0eb1, 0x0fee4ad0,
+    0x0feeae6c, 0x0feeeeeb, 0x0fef19ed, 0x0fef34eb, 0x0ff059ee, 0x0ff079f0, 0x0ff0b0c5, 0x0ff0d9ef,
+    0x0ff0f9f2, 0x0ff119f1, 0x0ff150b2, 0x0ff199f3, 0x0ff1cefc, 0x0ff299f4, 0x0ff359f7, 0x0ff3b9f6,
+    0x0ff3d9f5, 0x0ff479f8, 0x0ff48851, 0x0ff50c01, 0x0ff527a0, 0x0ff5d9fc, 0x0ff5f9f9, 0x0ff659fa,
+    0x0ff6d9fd, 0x0ff719fe, 0x0ff739fb, 0x0ff7a608, 0x0ff82665, 0x0ff8ba00, 0x0ff8da01, 0x0ff95a02,
+    0x0ff990c2, 0x0ffa4a8b, 0x0ffa9a04, 0x0ffaba03, 0x0ffc0b89, 0x0ffc3a05, 0x0ffcda06, 0x0ffd3a07,
+    0x0ffd6763, 0x0ffe074b, 0x0ffe7a08, 0x0fff3a09, 0x0fff6ffc, 0x0fff90c3, 0x100010b3, 0x10003156,
+    0x1000692c, 0x10009a0c, 0x1000aa52, 0x1000da0b, 0x10017a0d, 0x10018a27, 0x10020c8f, 0x10025a0e,
+    0x1002a92b, 0x1002f055, 0x10031a0f, 0x10033a10, 0x10039a11, 0x10043a12, 0x10051a13, 0x10066a28,
+    0x1006d06b, 0x10077a15, 0x1007acde, 0x1007fa14, 0x1008da17, 0x10095a16, 0x100a5a18, 0x100acbb9,
+    0x100b1a19, 0x100b5a1a, 0x100bcf77, 0x100bfa1b, 0x100c2c4f, 0x100c5a1c, 0x100d1a1d, 0x100df13c,
+    0x100e1a20, 0x100e5a1f, 0x100e7a1e, 0x100e8d2e, 0x100eda21, 0x100eeb45, 0x100f3a22, 0x100fba23,
+    0x100fd157, 0x100ffa24, 0x10109a25, 0x1010ba27, 0x1010da26, 0x1010eea3, 0x10112e37, 0x1011715d,
+    0x10118ea7, 0x10127a29, 0x1012cb11, 0x10130f09, 0x10135a2a, 0x10137a28, 0x1013a74c, 0x101428d2,
+    0x10144a08, 0x1014aeec, 0x101528a8, 0x10154fe2, 0x10159a2d, 0x1015ba2b, 0x1015e92d, 0x1016292e,
+    0x101645e7, 0x101689a6, 0x10174e78, 0x101865dd, 0x10189a32, 0x1018ccdf, 0x10198e77, 0x1019cc99,
+    0x101ada34, 0x101b3a30, 0x101b5a33, 0x101b7a2e, 0x101bba31, 0x101bcfc5, 0x101c28d3, 0x101c85fb,
+    0x101cba2f, 0x101dfa36, 0x101e3a37, 0x101e8df7, 0x101f07f9, 0x101f9a45, 0x101fae5c, 0x10204a09,
+    0x1020a7fa, 0x1020cbc6, 0x1020f165, 0x1021102c, 0x10213a35, 0x10214bd2, 0x102347b2, 0x10237a38,
+    0x10247a3a, 0x10253a39, 0x1025fa3b, 0x10262cc5, 0x10266e5d, 0x10272d2f, 0x1027da42, 0x1028da41,
+    0x10297a3c, 0x1029cb74, 0x102a0f45, 0x102a3a44, 0x102a7a43, 0x102a892f, 0x102ab172, 0x102bfa54,
+    0x102cba48, 0x102cda49, 0x102d6a6e, 0x102dda47, 0x102e0958, 0x102e3a46, 0x102e9a4a, 0x102f0d30,
+    0x102f2f60, 0x102f4c02, 0x102fec9a, 0x10301a4e, 0x10305a4f, 0x10307a4b, 0x10311a4c, 0x10315a4d,
+    0x1031e930, 0x10327a55, 0x1032ba51, 0x10334f46, 0x1033900c, 0x1033af07, 0x10341a50, 0x10347a53,
+    0x10349a52, 0x10350fe3, 0x10353a56, 0x10361a57, 0x10366c16, 0x1036ba58, 0x10371a5a, 0x10375a5e,
+    0x1037ba5b, 0x1037da59, 0x1037ee5e, 0x10381a5c, 0x10385a5d, 0x1038c670, 0x10391a64, 0x10393a5f,
+    0x1039ba60, 0x103a3a61, 0x103a6c5f, 0x103b1a63, 0x103b3a62, 0x103b5a65, 0x103bfa66, 0x103c1a67,
+    0x103c6b62, 0x103ca6a7, 0x103cfa68, 0x103d1115, 0x103d4a29, 0x103daa8c, 0x103e6a0a, 0x103e8cf6,
+    0x103f5a69, 0x103f7a6a, 0x103f8610, 0x103fda6b, 0x10403a6c, 0x10405a6d, 0x1040ba6e, 0x1040fa6f,
+    0x104107fb, 0x10413568, 0x10415a70, 0x10418be3, 0x1041ba71, 0x1041ca49, 0x10421a72, 0x104251ae,
+    0x1042da73, 0x1042ef9c, 0x1043075a, 0x10436c03, 0x10438ab7, 0x1043cf51, 0x1043ea8d, 0x10453a74,
+    0x10454931, 0x10457a75, 0x10458eca, 0x1045da84, 0x10467a77, 0x1046ac87, 0x1046ce95, 0x1046e8bd,
+    0x10471a76, 0x10472c04, 0x10481a78, 0x1048ed78, 0x104b1a7a, 0x104b3a79, 0x104b5a7c, 0x104bba7b,
+    0x104bfa7d, 0x104c5a80, 0x104c9a7e, 0x104cc74d, 0x104d1a81, 0x104d5a82, 0x104d7a83, 0x104dc96f,
+    0x104df107, 0x104e3a85, 0x104e4b46, 0x104ec650, 0x104efa86, 0x104f1a87, 0x104fda88, 0x105165f0,
+    0x1051ba89, 0x10525a8a, 0x10532f47, 0x1053aa45, 0x1053fa8c, 0x1054a6c8, 0x1054c5b0, 0x10557a8b,
+    0x10559a8e, 0x1055ae6d, 0x1055eb63, 0x10562694, 0x10566fc6, 0x1057087c, 0x1057281a, 0x10577a8d,
+    0x1057a6a8, 0x1058a721, 0x105a2651, 0x105a5a92, 0x105a7128, 0x105a8c9b, 0x105aef23, 0x105b3a9e,
+    0x105b6695, 0x105b9a9c, 0x105bda9a, 0x105bfa91, 0x105c3a8f, 0x105c7a90, 0x105caa61, 0x105cc82a,
+    0x105ced17, 0x105d6e0f, 0x105e2630, 0x105e7a94, 0x105e9a93, 0x105f3a99, 0x105f5a95, 0x105f7a98,
+    0x1060504e, 0x10607a97, 0x10608696, 0x1060a71d, 0x1060da9b, 0x10613a9d, 0x1061c873, 0x1062daa1,
+    0x1062faaa, 0x10631aab, 0x106385a9, 0x10647ab2, 0x106505ef, 0x10657aa9, 0x1065faa8, 0x10663aa3,
+    0x10665aa2, 0x10669aa0, 0x1066ba9f, 0x1066cd03, 0x10670cb9, 0x10673aa5, 0x10681aa4, 0x1068baa7,
+    0x10692c50, 0x10694874, 0x1069e620, 0x106a1aa6, 0x106a4932, 0x106b0c51, 0x106e7ab8, 0x106ebab9,
+    0x106ee697, 0x106f666c, 0x106f9ab6, 0x1070baac, 0x1070fab4, 0x10713abb, 0x10715ab5, 0x1071dab3,
+    0x10727a96, 0x1072dab1, 0x10735aad, 0x1073c74e, 0x1073faaf, 0x10741aba, 0x10745ab0, 0x10751abc,
+    0x10755aae, 0x10756e9c, 0x107630c9, 0x1076bab7, 0x1077bacd, 0x10783ac5, 0x1078ab9b, 0x107947a5,
+    0x1079881b, 0x1079dac0, 0x107a6699, 0x107acb12, 0x107b1ac3, 0x107b8998, 0x107bedb0, 0x107c1ac8,
+    0x107d2fac, 0x107d7abf, 0x107de698, 0x107e08d4, 0x107e2f08, 0x107e5ac9, 0x107e9abd, 0x107efac6,
+    0x107f7ad0, 0x107fbac1, 0x10807ac2, 0x10808df8, 0x1080fac7, 0x10817ac4, 0x10818fc7, 0x1081baca,
+    0x1081c5de, 0x10827abe, 0x10841acc, 0x10845acb, 0x10852e8b, 0x10855ad2, 0x10859add, 0x1086271e,
+    0x1086bae0, 0x10871ace, 0x10879ad3, 0x1087b0ce, 0x1088dadc, 0x108930b4, 0x1089d0e8, 0x108aed18,
+    0x108b670b, 0x108c2f52, 0x108c5ae2, 0x108c6ddf, 0x108cc5af, 0x108d3adb, 0x108d7ad7, 0x108d8c52,
+    0x108dbad1, 0x108ddad9, 0x108dfade, 0x108e2e4b, 0x108ea5a8, 0x108efad6, 0x108f3adf, 0x108f4f58,
+    0x10905ada, 0x10909ad5, 0x10916b13, 0x10920a8e, 0x10928a2a, 0x10933056, 0x10938f26, 0x1093fae5,
+    0x10943aee, 0x1095bad8, 0x10964717, 0x10970b36, 0x10973ae3, 0x10977ae8, 0x10978c53, 0x1097fae4,
+    0x10983aeb, 0x10988cfe, 0x1098daec, 0x109930b5, 0x10995ae1, 0x109966d7, 0x1099bae7, 0x109a1aea,
+    0x109a302a, 0x109adaed, 0x109b3ae6, 0x109b5ae9, 0x109d8fc8, 0x109dd140, 0x109e9af1, 0x109f9af8,
+    0x109ffaf0, 0x10a00a41, 0x10a0dacf, 0x10a22f8c, 0x10a27020, 0x10a29af7, 0x10a2baf6, 0x10a2faf2,
+    0x10a31af3, 0x10a34615, 0x10a3faf5, 0x10a43aef, 0x10a4cd53, 0x10a59af4, 0x10a5a5fc, 0x10a6ac60,
+    0x10a7af81, 0x10a81af9, 0x10a83b00, 0x10a86ed7, 0x10a91afc, 0x10a92b14, 0x10a94a47, 0x10a97b02,
+    0x10a9c7fc, 0x10aabb03, 0x10aaef59, 0x10ab1afb, 0x10ab5ad4, 0x10ac7afa, 0x10ad116e, 0x10ad2de0,
+    0x10ad4f53, 0x10adbb0a, 0x10aefb10, 0x10afdb11, 0x10b01b04, 0x10b08e96, 0x10b0fb0e, 0x10b11b06,
+    0x10b15b08, 0x10b21b12, 0x10b23b07, 0x10b29b0b, 0x10b2e652, 0x10b32e23, 0x10b37b0c, 0x10b39b0f,
+    0x10b49b05, 0x10b4cc05, 0x10b51b09, 0x10b529c6, 0x10b54b64, 0x10b5684f, 0x10b59072, 0x10b5d077,
+    0x10b5ead2, 0x10b73b16, 0x10b75b14, 0x10b8316d, 0x10b93b13, 0x10b9b0d5, 0x10b9fb15, 0x10ba1b17,
+    0x10babb18, 0x10bb9b1b, 0x10bbbb19, 0x10bc8de1, 0x10bcbb1a, 0x10bd2ecb, 0x10bd5b0d, 0x10beead3,
+    0x10bf3b1c, 0x10bf5b21, 0x10bf6c54, 0x10bfdb20, 0x10c05b01, 0x10c0db22, 0x10c0ec28, 0x10c15b1d,
+    0x10c17b1f, 0x10c27b1e, 0x10c2d690, 0x10c2f681, 0x10c35b24, 0x10c45b23, 0x10c5b0d6, 0x10c5f87a,
+    0x10c61b25, 0x10c7fb26, 0x10c9bb27, 0x10c9c8d5, 0x10ca07b3, 0x10ca9b29, 0x10cab23c, 0x10cb47d5,
+    0x10cb90f8, 0x10cbc831, 0x10cbfb2a, 0x10ccfb2b, 0x10cd6d0e, 0x10ce3b2c, 0x10cf2e38, 0x10cf65b8,
+    0x10d146a1, 0x10d17b31, 0x10d19b32, 0x10d27b2d, 0x10d2a9dc, 0x10d47b2e, 0x10d48e61, 0x10d53b2f,
+    0x10d55b30, 0x10d57b3a, 0x10d5fb34, 0x10d61b37, 0x10d6db33, 0x10d89b35, 0x10d8db36, 0x10d8ea56,
+    0x10d93b38, 0x10d96ce0, 0x10d9a875, 0x10d9c6e1, 0x10da9b3b, 0x10db26de, 0x10db7b41, 0x10dbdb3c,
+    0x10dbfb40, 0x10dc8eb8, 0x10dd3b3d, 0x10dd9b3e, 0x10ddaf27, 0x10ddced8, 0x10ddfb42, 0x10df0cbb,
+    0x10df3b4c, 0x10df7b48, 0x10dfc6a9, 0x10e01b46, 0x10e04fc9, 0x10e07b47, 0x10e0db44, 0x10e11b45,
+    0x10e13b4a, 0x10e15b4d, 0x10e1bb4b, 0x10e23b49, 0x10e25b43, 0x10e30cf7, 0x10e35b54, 0x10e39028,
+    0x10e4bb52, 0x10e53b53, 0x10e69b4e, 0x10e6fb50, 0x10e77b51, 0x10e7fb4f, 0x10e92be4, 0x10e97158,
+    0x10e99b58, 0x10e9db59, 0x10ea7b5f, 0x10eaab49, 0x10eafb5b, 0x10eb3b5e, 0x10ebfb56, 0x10ec1b55,
+    0x10ec7b60, 0x10ecc69a, 0x10ed1b5c, 0x10ed5b61, 0x10eddb5d, 0x10ee9b5a, 0x10eecd31, 0x10ef1b57,
+    0x10efee88, 0x10f05b65, 0x10f1b09a, 0x10f3fb64, 0x10f45b63, 0x10f57b6c, 0x10f5fb66, 0x10f67b6e,
+    0x10f750c6, 0x10f77b71, 0x10f7bb68, 0x10f81b69, 0x10f89b6d, 0x10f8db70, 0x10f8fb6f, 0x10f97b67,
+    0x10fa1b6a, 0x10fa5b7b, 0x10fc1b74, 0x10fdfb72, 0x10fe5b73, 0x10fedb78, 0x10fefb79, 0x10ff26c9,
+    0x10ff67a1, 0x10ffdb77, 0x1100bb62, 0x1101bb76, 0x1101db7a, 0x1101fb75, 0x11023b7c, 0x1102bb7e,
+    0x1102db7d, 0x11043b80, 0x11045b7f, 0x11047b39, 0x1104fb84, 0x11063b81, 0x1106db82, 0x11073b83,
+    0x11077b85, 0x1108088c, 0x11085b87, 0x11089b86, 0x1108ca8f, 0x11098933, 0x1109b6e5, 0x110a5b88,
+    0x110a6ab0, 0x110ae6d8, 0x110b3b89, 0x110b6631, 0x110bab15, 0x110bdb8a, 0x110c2934, 0x110c5b8b,
+    0x110c65df, 0x110d0f1c, 0x110d7b8c, 0x110e0b8a, 0x110e5b93, 0x110ebb90, 0x110eed0f, 0x110fbb91,
+    0x110fdb8e, 0x110fe81c, 0x11103b8d, 0x11105b94, 0x11110855, 0x11116c9c, 0x1111bb9a, 0x11125b96,
+    0x1112cc73, 0x1112fb95, 0x11133b98, 0x1113db8f, 0x11145b99, 0x11149b9b, 0x11156eed, 0x1115db97,
+    0x11161b9c, 0x11163b9e, 0x111688d1, 0x1116bb92, 0x1116e5bf, 0x1117fb9d, 0x11182999, 0x11185134,
+    0x11187b9f, 0x11189ba0, 0x1118ac55, 0x1119f0e0, 0x111a9ba1, 0x111ab094, 0x111b1ba2, 0x111b3ba3,
+    0x111b8fa2, 0x111bbba4, 0x111be97e, 0x111c30e1, 0x111d1ba9, 0x111e5baa, 0x111e6b16, 0x111e9ba8,
+    0x111f10c7, 0x111f3ba5, 0x111f9ba7, 0x111fabbb, 0x111fcb9e, 0x11205ba6, 0x11209bab, 0x1120ef61,
+    0x11215bad, 0x11219bac, 0x1122070c, 0x11224fca, 0x11227bae, 0x1123bbba, 0x1123dbb0, 0x1124bbb1,
+    0x11255bb2, 0x11257bb3, 0x1126dbb7, 0x11271bb8, 0x11277bb6, 0x11283bb4, 0x11287baf, 0x11289bb5,
+    0x11299bb9, 0x1129bdb5, 0x112ac666, 0x112bdbbc, 0x112be81d, 0x112c1bbb, 0x112c9bc1, 0x112cdbc0,
+    0x112d5bc3, 0x112dbbc2, 0x112dfbc4, 0x112e4a90, 0x112e9bc5, 0x112efbc6, 0x112fdbc7, 0x112febbc,
+    0x113030b6, 0x11307bc8, 0x1130cf62, 0x1130ee65, 0x11311bc9, 0x11315bca, 0x113168a9, 0x1131e78b,
+    0x11327bcb, 0x1132ca0b, 0x1132ee60, 0x11331bcc, 0x113346ef, 0x11343bcd, 0x1134dbcf, 0x1134f0d7,
+    0x11353bce, 0x11354b65, 0x11359bd0, 0x1135fbd1, 0x11365bd2, 0x1136674f, 0x11375bd3, 0x1137bbd4,
+    0x1137fbd5, 0x11381bd6, 0x113a46f0, 0x113b5bd7, 0x113b9bd8, 0x113bbbd9, 0x113c66b0, 0x113ccb47,
+    0x113cfbda, 0x113e9bdb, 0x113f1bdc, 0x114008be, 0x11404d79, 0x11407bdd, 0x11410876, 0x11414b75,
+    0x11419be0, 0x1141cde2, 0x11421bdf, 0x11426850, 0x1142dbde, 0x1142ecb5, 0x1143078c, 0x11437be1,
+    0x1143bbe2, 0x1143eb17, 0x1144688d, 0x1144bbe3, 0x11454fcb, 0x1145abdd, 0x114627d6, 0x11467073,
+    0x11468c29, 0x1146dbe4, 0x11474b66, 0x11476d10, 0x11478b18, 0x11483be5, 0x1148dbe8, 0x11491be9,
+    0x114a097c, 0x114a2c80, 0x114a5be7, 0x114a8b19, 0x114aaf1d, 0x114b7be6, 0x114bca0c, 0x114c0632,
+    0x114c5bed, 0x114c6877, 0x114cca0e, 0x114d2a0d, 0x114d716c, 0x114d9bec, 0x114dbbeb, 0x114dcc06,
+    0x114e07ac, 0x114e3162, 0x114e46d9, 0x114e6b1a, 0x114f9bea, 0x11505bef, 0x11509bf0, 0x1150bbee,
+    0x1150e8d6, 0x1151309f, 0x11518a0f, 0x1151ae46, 0x11523bf3, 0x11526bbe, 0x1152ace1, 0x11531095,
+    0x11535bf6, 0x1153c8ea, 0x11540bbd, 0x11543bf2, 0x11547bf7, 0x115488eb, 0x1154bbf4, 0x1154dbf5,
+    0x11551bf1, 0x11558be0, 0x1155ae07, 0x11560cce, 0x1156469b, 0x11572eee, 0x115787a2, 0x1157ed32,
+    0x11585bfa, 0x11589bf8, 0x1158eceb, 0x11596bbf, 0x11598750, 0x1159bbf9, 0x1159eb7a, 0x115a5108,
+    0x115ad15f, 0x115b5bfb, 0x115b7c07, 0x115b8d33, 0x115bdc06, 0x115c1c03, 0x115c3c0b, 0x115c5c04,
+    0x115c9c00, 0x115ccd7a, 0x115cfbfe, 0x115d7bfc, 0x115db080, 0x115dca10, 0x115e3c01, 0x115e7bfd,
+    0x115efc05, 0x115f0ad4, 0x115f48bf, 0x115fccb8, 0x11600fe4, 0x11602639, 0x116045e0, 0x11608de3,
+    0x1160fc09, 0x11619c08, 0x1161ce24, 0x11621c0d, 0x11629c02, 0x1162dc0c, 0x1162fc0e, 0x116328aa,
+    0x11635c0a, 0x11636935, 0x1163aa53, 0x11641c0f, 0x116430b7, 0x1164dc12, 0x11651c15, 0x11657c13,
+    0x11658f14, 0x11667c10, 0x1167281e, 0x1167dc14, 0x11683c16, 0x11693c1a, 0x11699c17, 0x1169dc19,
+    0x1169fc18, 0x116adc1b, 0x116b0a2f, 0x116b5c1d, 0x116b7c1c, 0x116b8f48, 0x116bfc1f, 0x116cc878,
+    0x116d7c1e, 0x116d9c20, 0x116dfc21, 0x116e07a3, 0x116e39ff, 0x116e4b37, 0x116e9c22, 0x116ee8ec,
+    0x116fbc23, 0x11701c24, 0x117069dd, 0x1171558c, 0x11719c25, 0x1171dc26, 0x11720a91, 0x11725c27,
+    0x11727c28, 0x1172dc29, 0x11733c2a, 0x11735c2b, 0x1186ecca, 0x11875c2c, 0x1187fc2e, 0x11883c2d,
+    0x1188cde4, 0x11891c2f, 0x11894fcc, 0x11899c30, 0x1189dc31, 0x118a1c32, 0x118abc33, 0x118b4e18,
+    0x118c2b1b, 0x118c5c34, 0x118d494b, 0x118d71ac, 0x118d9c35, 0x118f1c36, 0x118f2f1e, 0x118f5c37,
+    0x118f9c3f, 0x11905c38, 0x1190bc3a, 0x11913c39, 0x11915c3b, 0x11918fe5, 0x1191bc3c, 0x1191dc3d,
+    0x11929c3e, 0x11931c40, 0x1193a6cc, 0x1193cd65, 0x11940f49, 0x119429a0, 0x11944936, 0x1194ef2e,
+    0x1195069d, 0x11952ecc, 0x11955c43, 0x11956751, 0x11958bd3, 0x1195bc42, 0x1195dc47, 0x1195ed19,
+    0x11961061, 0x11965c45, 0x11967c46, 0x1196878d, 0x1196dc48, 0x1196ee83, 0x11970c9d, 0x11976eef,
+    0x11978d9c, 0x1197bc44, 0x1197efe6, 0x119806aa, 0x11983c4a, 0x11985147, 0x11986d40, 0x11989164,
+    0x1198ea11, 0x11991c49, 0x11994c6f, 0x1199bc5a, 0x1199cc07, 0x119a2e36, 0x119a6f2f, 0x119b5c4d,
+    0x119b69de, 0x119b8a12, 0x119bcb1c, 0x119c0e85, 0x119c48ab, 0x119c7c4c, 0x119c9c4b, 0x119ccf4a,
+    0x119d4a3f, 0x119dadb1, 0x119f5c4f, 0x119f7c50, 0x119f8937, 0x119fbc4e, 0x11a09c51, 0x11a0bc52,
+    0x11a0fc54, 0x11a10c61, 0x11a15c53, 0x11a16764, 0x11a1bc56, 0x11a1fc55, 0x11a21c57, 0x11a27c59,
+    0x11a29c5b, 0x11a2dc5c, 0x11ac8bd4, 0x11acca4d, 0x11acfc5d, 0x11ad66f1, 0x11adbc5e, 0x11ae0c56,
+    0x11ae3c5f, 0x11ae7c60, 0x11ae8f4b, 0x11aee78e, 0x11b03c61, 0x11b0ad34, 0x11b1463a, 0x11b33c62,
+    0x11b46a6f, 0x11b50b96, 0x11b66c6b, 0x11b75c65, 0x11b7dc64, 0x11b85c63, 0x11b97c6b, 0x11b99c69,
+    0x11b9fc66, 0x11badc68, 0x11bb5c67, 0x11bb7c6a, 0x11bba7d7, 0x11bbfc6e, 0x11bc2bd5, 0x11bc7c6f,
+    0x11bd08d7, 0x11bd5c6c, 0x11bd7c6d, 0x11bdf148, 0x11be6d35, 0x11beac08, 0x11bf9c70, 0x11bffc73,
+    0x11c11c71, 0x11c13c72, 0x11c150b8, 0x11c1ede5, 0x11c21c76, 0x11c3bc74, 0x11c3dc75, 0x11c3fc77,
+    0x11c55c88, 0x11c61c7a, 0x11c69c7b, 0x11c6bc79, 0x11c85c78, 0x11c88d7b, 0x11c8fc80, 0x11c91c84,
+    0x11c93c81, 0x11c95c7c, 0x11c99c82, 0x11ca1c83, 0x11cabc8a, 0x11cb3c85, 0x11cbebd6, 0x11cc1c87,
+    0x11cc7c89, 0x11cc9c86, 0x11ce5c8c, 0x11ce8a92, 0x11cedc8b, 0x11cf9c8d, 0x11d03c8e, 0x11d09c91,
+    0x11d0bc90, 0x11d0fc8f, 0x11d15c93, 0x11d17c92, 0x11d1b074, 0x11d23c95, 0x11d27c94, 0x11d29c96,
+    0x11d33c97, 0x11d43c99, 0x11d55c98, 0x11d56b67, 0x11d59c9a, 0x11d5e82b, 0x11d61c9b, 0x11d63c9d,
+    0x11d7dc9e, 0x11d8bc9f, 0x11d8dc9c, 0x11d91ca0, 0x11d94a54, 0x11d97ca1, 0x11d9878f, 0x11d9a852,
+    0x11da48ac, 0x11db7ca2, 0x11dbee2e, 0x11dc4d9d, 0x11dc7ca3, 0x11dd7ca6, 0x11df0a32, 0x11df7ca5,
+    0x11df9ca4, 0x11dfa879, 0x11dfdca7, 0x11e066f2, 0x11e0bca9, 0x11e1299a, 0x11e15ca8, 0x11e19cb1,
+    0x11e25cab, 0x11e27cad, 0x11e28fa3, 0x11e2bcaa, 0x11e33cac, 0x11e37cb0, 0x11e39cae, 0x11e3a790,
+    0x11e3fcaf, 0x11e4dcb2, 0x11e52e79, 0x11e55116, 0x11e5ea93, 0x11e67cb3, 0x11e71081, 0x11e73cb5,
+    0x11e77cb4, 0x11e7dcb8, 0x11e7f0a0, 0x11e85cb7, 0x11e8870d, 0x11e8bcb6, 0x11e8dcbb, 0x11e93cba,
+    0x11e99cb9, 0x11e9ad91, 0x11e9dcbc, 0x11eafcbd, 0x11eb9cbe, 0x11ebe94c, 0x11ec2844, 0x11ec5cc0,
+    0x11ec7cc1, 0x11ec9cc2, 0x11f36b68, 0x11f39cc3, 0x11f3ca2b, 0x11f3fcc4, 0x11f47cc5, 0x11f4f25f,
+    0x11f5125e, 0x11f5bcc6, 0x11f5d9d0, 0x11f5fcc7, 0x11f60cc3, 0x11f62b4a, 0x11f64e5f, 0x11f6fcc8,
+    0x11f74f93, 0x11f76d52, 0x11f7895e, 0x11f7ecc8, 0x11f84609, 0x11f89018, 0x11f8ab76, 0x11f9c87d,
+    0x11fa281f, 0x11fa8f94, 0x11fb5cc9, 0x11fc5ccb, 0x11fcbcca, 0x11fcc69e, 0x11fd2e34, 0x11fd5ccc,
+    0x11fd6e97, 0x11fdad92, 0x11fdfccd, 0x11fe0ab1, 0x11fe9ccf, 0x11fef040, 0x11ff1cde, 0x11ff3cd1,
+    0x11ff5cd2, 0x11ffad47, 0x12000c9e, 0x12002c57, 0x12006de6, 0x1200bcd0, 0x1200c7b4, 0x12017cd9,
+    0x1201bcd6, 0x1201dce3, 0x1201ede7, 0x12020d00, 0x12023cd3, 0x12026d7c, 0x12028db2, 0x1202bcd4,
+    0x1202dcd8, 0x1202eb80, 0x12032e87, 0x12034d4a, 0x1203abc0, 0x1203dcd7, 0x1203ec6c, 0x12040c62,
+    0x12043cd5, 0x120445a7, 0x12047141, 0x1204fcda, 0x1205cc9f, 0x12062a94, 0x12064b69, 0x1206bcdc,
+    0x1206dcdb, 0x120705ed, 0x12073cdd, 0x12078f0e, 0x1207dce5, 0x12082e19, 0x12084b8b, 0x1208acf8,
+    0x1208e836, 0x12093ce4, 0x12095096, 0x1209661e, 0x1209af95, 0x1209c69f, 0x1209fcdf, 0x120a1ce0,
+    0x120a3ce1, 0x120a5ce2, 0x120a6df9, 0x120a8cc2, 0x120aa5e1, 0x120adce6, 0x120b1ce7, 0x120b3f21,
+    0x120b8c7b, 0x120bdce8, 0x120c0653, 0x120c2c2b, 0x120c68ad, 0x120cb0b9, 0x120d1ce9, 0x120d2d8b,
+    0x120dac58, 0x120dca55, 0x120dfcea, 0x120e5ced, 0x120eaac5, 0x120edceb, 0x120eec0a, 0x120f0c09,
+    0x120f45e2, 0x120f9109, 0x120fbcef, 0x120feef0, 0x12101cf1, 0x12103cf0, 0x12105cee, 0x12107904,
+    0x12108752, 0x1210fcce, 0x12113cf3, 0x12115cf2, 0x1211fcf4, 0x12123097, 0x12146e1f, 0x1214cfcd,
+    0x12151cf5, 0x12154a57, 0x1215fcf6, 0x12163cf7, 0x1216bcf8, 0x12170d80, 0x121825e8, 0x12194938,
+    0x1219d159, 0x121b7cfc, 0x121c2853, 0x121c5cf9, 0x121c9cfa, 0x121d0f54, 0x121da6f3, 0x121eb098,
+    0x121ee7fd, 0x121fadb3, 0x12205cfd, 0x12225cfe, 0x12233cff, 0x1225ad81, 0x12261d01, 0x12265d00,
+    0x12292e11, 0x12295d02, 0x12296a95, 0x12298a5e, 0x1229ae7a, 0x1229cd11, 0x122a4a70, 0x122a8b8c,
+    0x122add03, 0x122b1d04, 0x122c4b7c, 0x122c7d05, 0x122cbd06, 0x122d3d07, 0x122d50cf, 0x122d8a96,
+    0x122e5d09, 0x122e7d08, 0x122ea939, 0x122ee953, 0x122f09df, 0x12305d0c, 0x1230eac6, 0x12313d0b,
+    0x12317d0a, 0x1231aca7, 0x123208ed, 0x12324bc1, 0x1232eeae, 0x12338a98, 0x12345d0d, 0x12348b1d,
+    0x12355d10, 0x12357d0e, 0x1235fd0f, 0x12369d12, 0x1236bd11, 0x12370b38, 0x12375d13, 0x12381d14,
+    0x12383d15, 0x1238cece, 0x1238e991, 0x12390a5f, 0x12393d16, 0x12397d17, 0x123990e2, 0x1239aaa4,
+    0x1239d06c, 0x1239f10a, 0x123a1d18, 0x123a2820, 0x123add19, 0x123b0d82, 0x123b7d1c, 0x123b8718,
+    0x123bab6a, 0x123bfd1a, 0x123c3d1b, 0x123c6d5e, 0x123ccff4, 0x123ce83a, 0x123ebd1e, 0x123edd1f,
+    0x123f9d1d, 0x123ffd21, 0x1241ae1d, 0x1241c6e2, 0x12423d25, 0x12429d22, 0x1242bd24, 0x1243dd20,
+    0x12453d6e, 0x12459d23, 0x12469129, 0x1246e8d8, 0x1247fd2d, 0x12488d93, 0x1248bd28, 0x12491d2b,
+    0x12493d29, 0x12497d2e, 0x124a1d2f, 0x124afd27, 0x124b5d34, 0x124b6654, 0x124bdd26, 0x124c4eab,
+    0x124c9d2a, 0x124ccb1e, 0x124e293a, 0x124fcfe7, 0x12500822, 0x12506aa5, 0x1250adfa, 0x12522c0c,
+    0x12527d32, 0x1252bd2c, 0x1252dd31, 0x12531041, 0x12534d36, 0x12537d33, 0x12539d30, 0x1255ac0b,
+    0x1256fd37, 0x12573d36, 0x1259fd35, 0x125a4fce, 0x125c8adb, 0x125d3d38, 0x125d4f9d, 0x125da633,
+    0x125e4f25, 0x125e6d12, 0x125f07d8, 0x125f5d3a, 0x125f893c, 0x1260c9cb, 0x1261fd39, 0x12620b8d,
+    0x12630b8e, 0x12633d40, 0x12635d42, 0x12640b39, 0x12645d41, 0x12647d43, 0x1264c811, 0x12650f24,
+    0x12656a60, 0x12659142, 0x1265dd3c, 0x1265e9b6, 0x1266515e, 0x1266bd45, 0x12675d44, 0x12677d46,
+    0x12689d3b, 0x12696e27, 0x1269adb4, 0x126a8d55, 0x126add4b, 0x126b6ce2, 0x126b9d47, 0x126c1d48,
+    0x126d884c, 0x126ddd4a, 0x126ea8ae, 0x126f9d49, 0x126fcb1f, 0x12718719, 0x12729d4f, 0x1272c97d,
+    0x1272ec59, 0x12734d48, 0x1274e6da, 0x12759d4d, 0x1275bd4e, 0x1275cd41, 0x12761d4c, 0x12773d50,
+    0x12787d56, 0x12791d59, 0x127a1d58, 0x127a2d8c, 0x127add51, 0x127afd52, 0x127b1d55, 0x127bbd57,
+    0x127c27fe, 0x127c9d5a, 0x127cbd54, 0x127d1d53, 0x12807d5e, 0x1280fd5f, 0x12821d60, 0x12827d5d,
+    0x12829d5c, 0x12830b20, 0x12832de8, 0x12835d5b, 0x12843d64, 0x12857d62, 0x1286bd63, 0x1286dd61,
+    0x12870cb6, 0x12875d65, 0x12883d66, 0x12889d68, 0x128a2753, 0x128a5d67, 0x128a7078, 0x128b5d73,
+    0x128b7d69, 0x128bdd6c, 0x128c1d6a, 0x128c5d6b, 0x128d5d6d, 0x128e1d6f, 0x128ebd70, 0x128efd71,
+    0x128f9d74, 0x128fbd72, 0x128fdd75, 0x128ffd77, 0x12903d76, 0x12aeed37, 0x12b01065, 0x12b05d78,
+    0x12b06c0d, 0x12b0fd79, 0x12b12f82, 0x12b15d7a, 0x12b166ca, 0x12b1e61b, 0x12b22755, 0x12b26754,
+    0x12b29d7b, 0x12b2dd7c, 0x12b31d7d, 0x12b33d7e, 0x12b41d80, 0x12b44756, 0x12b466f4, 0x12b4893d,
+    0x12b4aeb4, 0x12b4fd82, 0x12b51d81, 0x12b5bd83, 0x12b6463b, 0x12b73d86, 0x12b77d85, 0x12b79d84,
+    0x12b7dd87, 0x12b87d8a, 0x12b8e5c5, 0x12b95d88, 0x12b99d8c, 0x12b9bd8b, 0x12ba9d8e, 0x12babd8d,
+    0x12badd8f, 0x12bb0dec, 0x12bb9d90, 0x12bc3d91, 0x12bc5d93, 0x12bcbd92, 0x12c38f4c, 0x12c43d94,
+    0x12c51d95, 0x12c549a3, 0x12c5dd96, 0x12c5fd97, 0x12c64fe8, 0x12c76c2a, 0x12c7e5a2, 0x12c80c89,
+    0x12c85d98, 0x12c88f4d, 0x12c97d9b, 0x12c99d99, 0x12c9a93e, 0x12c9fd9a, 0x12ca08c0, 0x12cb6f83,
+    0x12cb9d9d, 0x12cbbd9f, 0x12cbdd9e, 0x12cbfda0, 0x12cc4600, 0x12cc6b77, 0x12cc8adc, 0x12cca757,
+    0x12ccdda1, 0x12cd4e86, 0x12cd9da3, 0x12ce0601, 0x12ce5da2, 0x12ce6d42, 0x12ceb10b, 0x12cecde9,
+    0x12cefd9c, 0x12cf10e4, 0x12cf48af, 0x12cfb0ba, 0x12d0a837, 0x12d0d0f2, 0x12d10847, 0x12d14ca0,
+    0x12d17a40, 0x12d1bda4, 0x12d1c6cb, 0x12d1eb8f, 0x12d286f5, 0x12d2bda6, 0x12d2fda7, 0x12d31da5,
+    0x12d32884, 0x12d3699b, 0x12d38b21, 0x12d40602, 0x12d47117, 0x12d4fda9, 0x12d51cec, 0x12d55da8,
+    0x12d61dac, 0x12d63daa, 0x12d65dab, 0x12d69dad, 0x12d6ddae, 0x12d6f12a, 0x12d71daf, 0x12d73db0,
+    0x12d76bc7, 0x12d78eb9, 0x12d80b9d, 0x12d82765, 0x12d89099, 0x12d8a6ab, 0x12d8ca97, 0x12d8e8d9,
+    0x12d93db3, 0x12d97db2, 0x12d98a13, 0x12d9bdb4, 0x12d9ddb1, 0x12da29c7, 0x12dabdb8, 0x12dadb6b,
+    0x12db3294, 0x12db6b97, 0x12db9db6, 0x12dc50e3, 0x12dc6e2f, 0x12dd060a, 0x12dd4be1, 0x12dd6a34,
+    0x12de0f75, 0x12de461f, 0x12ded12b, 0x12def0cb, 0x12df3db9, 0x12df6da4, 0x12e00a79, 0x12e09dba,
+    0x12e0ddbb, 0x12e0eb6b, 0x12e11dbc, 0x12e1512c, 0x12e1bdb7, 0x12e1ddbe, 0x12e1fdc0, 0x12e23dbf,
+    0x12e27dbd, 0x12e2ddc1, 0x12e33dc2, 0x12e38c5a, 0x12e3c6a0, 0x12e49dc3, 0x12e4f036, 0x12e55dc4,
+    0x12e61dc5, 0x12e65149, 0x12e715d0, 0x12e73dc6, 0x12e7bdc7, 0x12e7ddc8, 0x12e85dcc, 0x12e89dc9,
+    0x12e8ddca, 0x12e91dcb, 0x12e93dcd, 0x12ea4bc2, 0x12ead075, 0x12eb2bc3, 0x12eb9dce, 0x12ebcef1,
+    0x12ec1dcf, 0x12ec3ef2, 0x12ec504a, 0x12ec9dd0, 0x12ecddd1, 0x12ed1dd2, 0x12ed26f6, 0x12ed7dd4,
+    0x12edab78, 0x12ee3dd5, 0x12ee8843, 0x12ef3dd6, 0x12ef5dda, 0x12ef9dd8, 0x12f03dd9, 0x12f08713,
+    0x12f0bdd7, 0x12f0dddb, 0x12f17ddc, 0x12f1a5c6, 0x12f1fddd, 0x12f21dde, 0x12f30b22, 0x12f39ddf,
+    0x12f407a6, 0x12f47de2, 0x12f4dde1, 0x12f51de0, 0x12f57c11, 0x12f5af9a, 0x12f67de3, 0x12f69de4,
+    0x12f87de5, 0x12f8dde6, 0x12f91de7, 0x12f97de8, 0x12fa6758, 0x12fb9de9, 0x12fdbdea, 0x12fdce42,
+    0x12fe5dec, 0x12fe6679, 0x12febdef, 0x12feddee, 0x12ff6603, 0x12ffe7ff, 0x13002f85, 0x13004d38,
+    0x13006960, 0x1300a940, 0x1300cac7, 0x13010b7b, 0x13019df1, 0x1301fdf0, 0x130210a1, 0x13022766,
+    0x13024ed0, 0x13026e1a, 0x1302eb9c, 0x1303110c, 0x1303487a, 0x13043df4, 0x13049df3, 0x13058fea,
+    0x1305adea, 0x1306862f, 0x1306fdf5, 0x13071df2, 0x13076f30, 0x130790ca, 0x1307bdf6, 0x1308ddf7,
+    0x13097df9, 0x13098ca8, 0x1309a6fa, 0x1309c6fb, 0x1309fdf8, 0x130a8767, 0x130aa8b0, 0x130b0768,
+    0x130b6d9e, 0x130bd11e, 0x130ce8da, 0x130d7dfa, 0x130dfdfb, 0x130e1dfc, 0x130e3e00, 0x130e7e02,
+    0x130e9e01, 0x13150f57, 0x13155e03, 0x1315fe04, 0x13163e05, 0x1316de06, 0x13187e08, 0x13189e07,
+    0x1318de09, 0x131b6ef2, 0x131b9a0a, 0x131beb48, 0x131c4791, 0x131d3e0a, 0x131d7e0b, 0x131db26a,
+    0x131dd69a, 0x131deed1, 0x131e45f9, 0x131e85b9, 0x131f8a14, 0x131fafcf, 0x131fcb3c, 0x13207e0c,
+    0x1320b05d, 0x13213e0d, 0x132150bb, 0x13218621, 0x132209e0, 0x13225e0e, 0x132266ac, 0x13229e0f,
+    0x13231e10, 0x1323be12, 0x1323de13, 0x13241e15, 0x13243e11, 0x13249e14, 0x13250759, 0x13259e16,
+    0x1325de17, 0x1327be18, 0x1327de19, 0x13285e1a, 0x1328be1c, 0x13293e1b, 0x13297e1e, 0x13299e21,
+    0x132a1e1d, 0x132a3e1f, 0x132a5e20, 0x132abe22, 0x132ae800, 0x1332ca71, 0x1332fe23, 0x13331e24,
+    0x13332941, 0x1334be25, 0x133506dd, 0x13358e6e, 0x1335be26, 0x1335de27, 0x13366cf9, 0x13368e29,
+    0x13379e28, 0x13382e9d, 0x13388c8a, 0x1338a637, 0x1338c82c, 0x1339082d, 0x133a0d13, 0x133a3e2d,
+    0x133a482e, 0x133aa6ad, 0x133b1e2c, 0x133b7e2a, 0x133bbe2b, 0x133bfe29, 0x133c5e37, 0x133dbe2e,
+    0x133dde2f, 0x133e3e30, 0x133e5e31, 0x133f1e33, 0x133f7e32, 0x133feab8, 0x13403e34, 0x1340be36,
+    0x1341c792, 0x1341fe35, 0x13424c5b, 0x134268b1, 0x13433e38, 0x13450c8b, 0x13457e39, 0x13460deb,
+    0x1346fe3a, 0x1347de40, 0x13481e3d, 0x13485e3c, 0x13487e3e, 0x1348be3b, 0x1349be42, 0x134abe41,
+    0x134afe44, 0x134b4801, 0x134b7e43, 0x134bfe45, 0x134c5e46, 0x134c9e48, 0x134cbe47, 0x134d3e49,
+    0x134d5e4b, 0x134d7e4a, 0x1355095c, 0x1355be4c, 0x13561e4d, 0x135706db, 0x13579e4e, 0x13581e4f,
+    0x13588b91, 0x1359fe50, 0x135a3e51, 0x135a7e52, 0x135a9e53, 0x135b0942, 0x135bde54, 0x135bfe55,
+    0x135c5e56, 0x135c7e57, 0x135cde58, 0x135d4eaf, 0x135d7e5a, 0x135daf05, 0x135dde5b, 0x135dfe59,
+    0x135e3e5d, 0x135e9e5c, 0x135efe5e, 0x135f7e5f, 0x1360de60, 0x13631e61, 0x13635e62, 0x1363fe63,
+    0x13645e64, 0x13647e65, 0x1364be66, 0x1364fe67, 0x13651e68, 0x13653e69, 0x13655e6a, 0x1365de6b,
+    0x1365fe6c, 0x13663694, 0x13665e6d, 0x13677976, 0x13678793, 0x136826c0, 0x13684970, 0x13687e6f,
+    0x13689e6e, 0x1368b023, 0x1369be71, 0x1369de72, 0x1369fe70, 0x136a3e73, 0x136a9002, 0x136b1e74,
+    0x136b47db, 0x136df144, 0x136e9e75, 0x13707e77, 0x1371c5bc, 0x13723e78, 0x13724f69, 0x13727e76,
+    0x1372de79, 0x1372fe7a, 0x1373fe7b, 0x13741e7c, 0x13751e7d, 0x1375500e, 0x137569cc, 0x1375a9b8,
+    0x1375cc0e, 0x13769e7e, 0x13773e81, 0x13781e7f, 0x1378de82, 0x137928ef, 0x13795e80, 0x1379fe83,
+    0x137a3e84, 0x137a5e85, 0x137a9e89, 0x137ac9c9, 0x137b6ca2, 0x137c3e8a, 0x137c5e87, 0x137c7e86,
+    0x137c9e88, 0x137d087e, 0x137e1e8e, 0x137e3e8d, 0x137e5e8c, 0x137ea5b1, 0x13809e98, 0x1380de94,
+    0x13811e95, 0x13813e91, 0x13815e97, 0x13819e93, 0x1381a702, 0x1382116b, 0x13825e96, 0x13827e92,
+    0x13829e90, 0x1382be8f, 0x13837e9a, 0x13843e9d, 0x13849e9c, 0x1384be9b, 0x1385af28, 0x1385de99,
+    0x1385e5f1, 0x13861e9e, 0x13865ea0, 0x1387270f, 0x13875e8b, 0x13876616, 0x1387dea2, 0x1388dea1,
+    0x1388fe9f, 0x13890ccc, 0x138a5010, 0x138af118, 0x138b5ea3, 0x138c1ea4, 0x138cfea5, 0x138edea6,
+    0x138f1ea7, 0x139cad39, 0x139cfea8, 0x139d2eb5, 0x139d7ead, 0x139d9ea9, 0x139e1eaa, 0x139e6fd0,
+    0x139e9042, 0x139ece0e, 0x13a07eae, 0x13a0deaf, 0x13a0edfc, 0x13a11eac, 0x13a13eab, 0x13a1c668,
+    0x13a25eb7, 0x13a2beb6, 0x13a36655, 0x13a3feb4, 0x13a47eb3, 0x13a4deb1, 0x13a5071b, 0x13a55eb0,
+    0x13a56a30, 0x13a58667, 0x13a76943, 0x13a7deba, 0x13a7feb9, 0x13a83eb8, 0x13a89eb5, 0x13a8debb,
+    0x13a91ebc, 0x13aa1ec4, 0x13aa3ec3, 0x13ab3ec5, 0x13ab860c, 0x13abbec0, 0x13abdec1, 0x13ac0954,
+    0x13ac3037, 0x13ac9ec2, 0x13ad8fd1, 0x13adfeca, 0x13ae5ec6, 0x13af5ecb, 0x13b0fec8, 0x13b13ec7,
+    0x13b1e87b, 0x13b35ecc, 0x13b49ecd, 0x13b53ece, 0x13b57ec9, 0x13b5feb2, 0x13b65ecf, 0x13b68d5f,
+    0x13b71ed3, 0x13b75ed4, 0x13b77ed2, 0x13b83ed1, 0x13b85ed7, 0x13b89ed0, 0x13b8ded5, 0x13b9fed6,
+    0x13ba7ed9, 0x13bb3ed8, 0x13bcdedb, 0x13bdbedc, 0x13bdfedd, 0x13be5168, 0x13bf1eda, 0x13bf2ca9,
+    0x13bf49ab, 0x13bfbede, 0x13c35edf, 0x13c37ee0, 0x13c3dee1, 0x13cebee2, 0x13cf08b2, 0x13cf3ee3,
+    0x13cfbee4, 0x13cfea2d, 0x13d03ee5, 0x13d11ee6, 0x13d17ee7, 0x13d19ee8, 0x13d23eeb, 0x13d25ee9,
+    0x13d2715b, 0x13d2beea, 0x13d2f12d, 0x13d3beec, 0x13d3f119, 0x13d4beed, 0x13d4ce9e, 0x13d53eee,
+    0x13d55ef0, 0x13d5bef1, 0x13d71eef, 0x13d7294d, 0x13d7504b, 0x13d77003, 0x13d79435, 0x13d7d6c0,
+    0x13d7f01b, 0x13d88669, 0x13d99ef3, 0x13d9a7af, 0x13d9def4, 0x13d9fef5, 0x13da1ef6, 0x13da4955,
+    0x13da9ef7, 0x13db17d2, 0x13db3059, 0x13db6ca1, 0x13db9ef8, 0x13dbbefa, 0x13dbdef9, 0x13dc1efb,
+    0x13dcbefc, 0x13dd1efd, 0x13ddfefe, 0x13de9f00, 0x13dedf01, 0x13deff02, 0x13df3f03, 0x13df7f04,
+    0x13df9f05, 0x13dfbf06, 0x13e0ff07, 0x13e11f08, 0x13e1cd83, 0x13e268db, 0x13e2bf0a, 0x13e40c2c,
+    0x13e43f0b, 0x13e59f0c, 0x13e76f00, 0x13e7df0d, 0x13e95f0e, 0x13e978d6, 0x13e9dc58, 0x13e9fdeb,
+    0x13ea5f0f, 0x13ea9f10, 0x13ebff12, 0x13ec1f13, 0x13ec3f14, 0x13ec512e, 0x13ec7f11, 0x13ecdf15,
+    0x13ecff16, 0x13ed5f18, 0x13ed9f17, 0x13ee5f1a, 0x13eedf1b, 0x13eeff19, 0x13f1b0f4, 0x13f2bf1c,
+    0x13f39f1d, 0x13f3b8f3, 0x13f41f1e, 0x1fe02009, 0x1fe06054, 0x1fe08050, 0x1fe0a053, 0x1fe0c055,
+    0x1fe10029, 0x1fe1202a, 0x1fe14056, 0x1fe1603b, 0x1fe18003, 0x1fe1c004, 0x1fe1e01e, 0x1fe200cf,
+    0x1fe220d0, 0x1fe240d1, 0x1fe260d2, 0x1fe280d3, 0x1fe2a0d4, 0x1fe2c0d5, 0x1fe2e0d6, 0x1fe300d7,
+    0x1fe320d8, 0x1fe34006, 0x1fe36007, 0x1fe38043, 0x1fe3a041, 0x1fe3c044, 0x1fe3e008, 0x1fe40057,
+    0x1fe420e0, 0x1fe440e1, 0x1fe460e2, 0x1fe480e3, 0x1fe4a0e4, 0x1fe4c0e5, 0x1fe4e0e6, 0x1fe500e7,
+    0x1fe520e8, 0x1fe540e9, 0x1fe560ea, 0x1fe580eb, 0x1fe5a0ec, 0x1fe5c0ed, 0x1fe5e0ee, 0x1fe600ef,
+    0x1fe620f0, 0x1fe640f1, 0x1fe660f2, 0x1fe680f3, 0x1fe6a0f4, 0x1fe6c0f5, 0x1fe6e0f6, 0x1fe700f7,
+    0x1fe720f8, 0x1fe740f9, 0x1fe7602d, 0x1fe7801f, 0x1fe7a02e, 0x1fe7c00f, 0x1fe7e011, 0x1fe8000d,
+    0x1fe82101, 0x1fe84102, 0x1fe86103, 0x1fe88104, 0x1fe8a105, 0x1fe8c106, 0x1fe8e107, 0x1fe90108,
+    0x1fe92109, 0x1fe9410a, 0x1fe9610b, 0x1fe9810c, 0x1fe9a10d, 0x1fe9c10e, 0x1fe9e10f, 0x1fea0110,
+    0x1fea2111, 0x1fea4112, 0x1fea6113, 0x1fea8114, 0x1feaa115, 0x1feac116, 0x1feae117, 0x1feb0118,
+    0x1feb2119, 0x1feb411a, 0x1feb602f, 0x1feb8022, 0x1feba030, 0x1ffc6010, 0x1ffca04f,
+};
+#endif
+
+// Decodes one UTF-8 character. Returns the number of bytes used (at least 1).
+// Invalid sequences are returned one byte at a time, with the codepoint 0xFFFFFFFF
+static inline uint32_t _jc_qre_utf8_decode(const uint8_t* input, uint32_t inputlength, uint32_t* codepoint)
+{
+    uint8_t c = input[0];
+    uint32_t length = c < 0x80 ? 1 : c < 0xC0 ? 0 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : c < 0xF8 ? 4 : 0;
+    if( length == 0 || length > inputlength )
+    {
+        *codepoint = 0xFFFFFFFF;
+        return 1;
+    }
+    uint32_t value = length == 1 ? c : (c & (0x7F >> length));
+    for( uint32_t i = 1; i < length; ++i )
+    {
+        if( (input[i] & 0xC0) != 0x80 )
+        {
+            *codepoint = 0xFFFFFFFF;
+            return 1;
+        }
+        value = (value << 6) | (input[i] & 0x3F);
+    }
+    *codepoint = value;
+    return length;
+}
+
+// Gets the 13 bit Kanji mode value of a unicode character, or 0xFFFFFFFF if it cannot be encoded in Kanji mode
+static inline uint32_t _jc_qre_kanji_value(uint32_t codepoint)
+{
+#if !defined(JC_QRE_NO_KANJI)
+    uint32_t low = 0;
+    uint32_t high = sizeof(JC_QRE_KANJI_TABLE) / sizeof(JC_QRE_KANJI_TABLE[0]);
+    while( low < high )
+    {
+        uint32_t mid = (low + high) / 2;
+        uint32_t value = JC_QRE_KANJI_TABLE[mid] >> 13;
+        if( value == codepoint )
+            return JC_QRE_KANJI_TABLE[mid] & 0x1FFF;
+        if( value < codepoint )
+            low = mid + 1;
+        else
+            high = mid;
+    }
+#else
+    (void)codepoint;
+#endif
+    return 0xFFFFFFFF;
+}
+
+// Counts the UTF-8 characters of a Kanji segment
+static inline uint32_t _jc_qre_utf8_count(const uint8_t* input, uint32_t inputlength)
+{
+    uint32_t count = 0;
+    for( uint32_t i = 0; i < inputlength; ++count )
+    {
+        uint32_t codepoint;
+        i += _jc_qre_utf8_decode(&input[i], inputlength - i, &codepoint);
+    }
+    return count;
+}
+
+static inline uint32_t _jc_qre_is_numeric(uint8_t c)
 {
-    if( _jc_qre_guess_type_numeric(input, inputlength) )
-        return JC_QRE_INPUT_TYPE_NUMERIC;
-    else if( _jc_qre_guess_type_alphanumeric(input, inputlength) )
-        return JC_QRE_INPUT_TYPE_ALPHANUMERIC;
+    return c >= '0' && c <= '9';
+}
+
+static inline uint32_t _jc_qre_is_alphanumeric(uint8_t c)
+{
+    return c >= ' ' && c <= 'Z' && JC_QRE_ALPHANUMERIC_MAPPINGS[c - ' '] != -1;
+}
+
+// Checks that all characters can be encoded with the mode
+static uint32_t _jc_qre_is_valid_segment(uint8_t type, const uint8_t* input, uint32_t inputlength)
+{
+    if( type == JC_QRE_INPUT_TYPE_NUMERIC )
+        return _jc_qre_guess_type_numeric(input, inputlength);
+    else if( type == JC_QRE_INPUT_TYPE_ALPHANUMERIC )
+        return _jc_qre_guess_type_alphanumeric(input, inputlength);
+    else if( type == JC_QRE_INPUT_TYPE_KANJI )
+    {
+        for( uint32_t i = 0; i < inputlength; )
+        {
+            uint32_t codepoint;
+            i += _jc_qre_utf8_decode(&input[i], inputlength - i, &codepoint);
+            if( _jc_qre_kanji_value(codepoint) == 0xFFFFFFFF )
+                return 0;
+        }
+        return 1;
+    }
+    return type == JC_QRE_INPUT_TYPE_BYTE;
+}
 
-    return JC_QRE_INPUT_TYPE_BYTE;
+// The number of data bits for a segment (excluding the mode and character count)
+// For Kanji, the length is the number of characters
+static inline uint32_t _jc_qre_get_segment_bits(uint8_t type, uint32_t inputlength)
+{
+    if( type == JC_QRE_INPUT_TYPE_KANJI )
+        return inputlength * 13;
+    if( type == JC_QRE_INPUT_TYPE_NUMERIC )
+        return (inputlength / 3) * 10 + ((inputlength % 3) ? (inputlength % 3) * 3 + 1 : 0);
+    else if( type == JC_QRE_INPUT_TYPE_ALPHANUMERIC )
+        return (inputlength / 2) * 11 + (inputlength & 1) * 6;
+    return inputlength * 8;
 }
 
-static void _jc_qre_encode_numeric(JCQRCodeSegment* seg, uint32_t maxsize, const uint8_t* input, uint32_t inputlength)
+static void _jc_qre_encode_numeric(JCQRCodeBitWriter* writer, const uint8_t* input, uint32_t inputlength)
 {
     uint32_t accum = 0;
     for( uint32_t i = 0; i < inputlength; ++i, ++input)
@@ -406,20 +1534,18 @@ static void _jc_qre_encode_numeric(JCQRCodeSegment* seg, uint32_t maxsize, const
         accum = accum * 10 + (uint32_t)(c - '0');
         if( i % 3 == 2 )
         {
-            _jc_qre_bitbuffer_write(seg->data.bits, maxsize, &seg->data.numbits, accum, 10);
+            _jc_qre_bitwriter_write(writer, accum, 10);
             accum = 0;
         }
     }
-    if( accum )
+    if( inputlength % 3 )
     {
         uint32_t num = inputlength % 3;
-        _jc_qre_bitbuffer_write(seg->data.bits, maxsize, &seg->data.numbits, accum, num * 3 + 1);
+        _jc_qre_bitwriter_write(writer, accum, num * 3 + 1);
     }
-    seg->elementcount = inputlength;
-    seg->type = JC_QRE_INPUT_TYPE_NUMERIC;
 }
 
-static void _jc_qre_encode_alphanumeric(JCQRCodeSegment* seg, uint32_t maxsize, const uint8_t* input, uint32_t inputlength)
+static void _jc_qre_encode_alphanumeric(JCQRCodeBitWriter* writer, const uint8_t* input, uint32_t inputlength)
 {
     const char* characters = (const char*)input;
     for( uint32_t i = 0; i < inputlength/2; ++i)
@@ -428,77 +1554,262 @@ static void _jc_qre_encode_alphanumeric(JCQRCodeSegment* seg, uint32_t maxsize,
         uint32_t v2 = (uint32_t)JC_QRE_ALPHANUMERIC_MAPPINGS[characters[i*2+1] - ' '];
         uint32_t value = (v1 * 45) + v2;
 
-        _jc_qre_bitbuffer_write(seg->data.bits, maxsize, &seg->data.numbits, value, 11);
-
-        //printf("hello: %c %c - > %u %u   %u bits\n", characters[i*2+0], characters[i*2+1], v1, v2, seg->data.numbits );
+        _jc_qre_bitwriter_write(writer, value, 11);
     }
     if( inputlength & 1 )
     {
         uint32_t v = (uint32_t)JC_QRE_ALPHANUMERIC_MAPPINGS[characters[inputlength-1] - ' '];
-        _jc_qre_bitbuffer_write(seg->data.bits, maxsize, &seg->data.numbits, v, 6);
+        _jc_qre_bitwriter_write(writer, v, 6);
     }
-    seg->elementcount = inputlength;
-    seg->type = JC_QRE_INPUT_TYPE_ALPHANUMERIC;
+}
+
+static void _jc_qre_encode_bytes(JCQRCodeBitWriter* writer, const uint8_t* input, uint32_t inputlength)
+{
+    _jc_qre_bitwriter_write_bytes(writer, input, inputlength);
+}
 
-    //printf("_jc_qre_encode_alphanumeric: %u chars   %u bits\n", inputlength, seg->data.numbits);
+// Expects the input to be valid for the Kanji mode
+static void _jc_qre_encode_kanji(JCQRCodeBitWriter* writer, const uint8_t* input, uint32_t inputlength)
+{
+    for( uint32_t i = 0; i < inputlength; )
+    {
+        uint32_t codepoint;
+        i += _jc_qre_utf8_decode(&input[i], inputlength - i, &codepoint);
+        _jc_qre_bitwriter_write(writer, _jc_qre_kanji_value(codepoint), 13);
+    }
 }
 
-static void _jc_qre_encode_bytes(JCQRCodeSegment* seg, uint32_t maxsize, const uint8_t* input, uint32_t inputlength)
+// Writes the segment data into the writer
+static void _jc_qre_encode_segment(JCQRCodeBitWriter* writer, const JCQRCodeSegment* seg)
 {
-    (void)maxsize;
-    memcpy(seg->data.bits, input, inputlength);
-    seg->data.numbits = inputlength * 8;
-    seg->elementcount = inputlength;
-    seg->type = JC_QRE_INPUT_TYPE_BYTE;
+    if( seg->type == JC_QRE_INPUT_TYPE_NUMERIC ) {
+        _jc_qre_encode_numeric(writer, seg->input, seg->length);
+    } else if( seg->type == JC_QRE_INPUT_TYPE_ALPHANUMERIC ) {
+        _jc_qre_encode_alphanumeric(writer, seg->input, seg->length);
+    } else if( seg->type == JC_QRE_INPUT_TYPE_KANJI ) {
+        _jc_qre_encode_kanji(writer, seg->input, seg->length);
+    } else {
+        _jc_qre_encode_bytes(writer, seg->input, seg->length);
+    }
 }
 
-static uint32_t _jc_qre_add_segment(JCQRCodeInternal* qr, const uint8_t* input, uint32_t inputlength)
+static uint32_t _jc_qre_add_segment(JCQRCodeInternal* qr, uint8_t type, const uint8_t* input, uint32_t inputlength)
 {
-    if( qr->num_segments >= sizeof(qr->segments)/sizeof(JCQRCodeSegment) )
-        return 0xFFFFFFFF;
+    if( qr->num_segments >= qr->max_segments )
+    {
+        uint32_t max_segments = qr->max_segments ? qr->max_segments * 2 : 8;
+        JCQRCodeSegment* segments = (JCQRCodeSegment*)realloc(qr->segments, sizeof(JCQRCodeSegment) * max_segments);
+        if( !segments )
+            return 0xFFFFFFFF;
+        qr->segments = segments;
+        qr->max_segments = max_segments;
+    }
 
-    JCQRCodeSegment* seg = &qr->segments[qr->num_segments];
+    // The total size of the segments is limited by the data buffer
     uint32_t offset = 0;
-    for( uint32_t i = 0; i < qr->num_segments; ++i )
+    if( qr->num_segments )
     {
-        offset += qr->segments[i].offset;
+        JCQRCodeSegment* prev = &qr->segments[qr->num_segments-1];
+        offset = prev->offset + (prev->numbits + 7) / 8;
     }
+
+    if( inputlength >= sizeof(qr->databuffer) )
+        return 0xFFFFFFFF;
+    uint32_t count = type == JC_QRE_INPUT_TYPE_KANJI ? _jc_qre_utf8_count(input, inputlength) : inputlength;
+    uint32_t numbits = _jc_qre_get_segment_bits(type, count);
+    if( offset + (numbits + 7) / 8 + 1 >= sizeof(qr->databuffer) )
+        return 0xFFFFFFFF;
+
+    // The data is encoded straight into the data buffer, once the version is selected
+    JCQRCodeSegment* seg = &qr->segments[qr->num_segments];
+    seg->input = input;
+    seg->length = inputlength;
+    seg->numbits = numbits;
     seg->offset = offset;
-    seg->data.bits = &qr->bitbuffer[offset];
+    seg->elementcount = count;
+    seg->type = type;
     qr->num_segments++;
+    return 0;
+}
 
-    seg->type = _jc_qre_guess_type(input, inputlength);
+// Splits the input into numeric, alphanumeric, byte and kanji segments, using the fewest bits for the given version.
+// Uses a dynamic program over the bytes, with the costs in 1/6 bits (numeric is 10/3 bits, alphanumeric 11/2 bits per character).
+// Switching modes costs the mode indicator and the character count of the new segment.
+// A Kanji character costs 13 bits for its first UTF-8 byte, and the modes only switch to or from Kanji between characters.
+// Kanji mode is only used for the Japanese characters (U+3000 and up) if 'kanji' is set, so Latin, Greek and Cyrillic text stays UTF-8.
+static uint32_t _jc_qre_split_segments(JCQRCodeInternal* qr, const uint8_t* input, uint32_t inputlength, uint32_t version, uint32_t kanji)
+{
+    qr->num_segments = 0;
+    if( inputlength == 0 )
+        return _jc_qre_add_segment(qr, JC_QRE_INPUT_TYPE_BYTE, input, 0);
 
-    uint32_t max_size = sizeof(qr->bitbuffer) - offset;
-    if( inputlength >= max_size )
-        return 0xFFFFFFFF;
+    // For each character and mode, the mode of the character, on the cheapest path that is in 'mode' after the character
+    uint32_t num_charmodes = inputlength * JC_QRE_NUM_AUTO_MODES;
+    if( num_charmodes > qr->charmodes_size )
+    {
+        uint8_t* charmodes = (uint8_t*)realloc(qr->charmodes, num_charmodes);
+        if( !charmodes )
+            return 0xFFFFFFFF;
+        qr->charmodes = charmodes;
+        qr->charmodes_size = num_charmodes;
+    }
 
-    if( seg->type == JC_QRE_INPUT_TYPE_NUMERIC ) {
-        _jc_qre_encode_numeric(seg, max_size, input, inputlength);
-    } else if( seg->type == JC_QRE_INPUT_TYPE_ALPHANUMERIC ) {
-        _jc_qre_encode_alphanumeric(seg, max_size, input, inputlength);
-    } else if( seg->type == JC_QRE_INPUT_TYPE_BYTE ) {
-        _jc_qre_encode_bytes(seg, max_size, input, inputlength);
+    static const uint32_t char_costs[JC_QRE_NUM_AUTO_MODES] = { 20, 33, 48, 78 };
+    const uint32_t infinity = 0xFFFFFFFF;
+
+    uint32_t head_costs[JC_QRE_NUM_AUTO_MODES];
+    uint32_t costs[JC_QRE_NUM_AUTO_MODES];
+    for( uint32_t m = 0; m < JC_QRE_NUM_AUTO_MODES; ++m )
+    {
+        head_costs[m] = (4 + JC_QRE_CHARACTER_COUNT_BIT_SIZE[JC_QRE_INDEX(m, version)]) * 6;
+        costs[m] = head_costs[m];
+    }
+
+    uint32_t char_remaining = 0;   // bytes left of the current UTF-8 character
+    uint32_t char_is_kanji = 0;
+    for( uint32_t i = 0; i < inputlength; ++i )
+    {
+        uint8_t c = input[i];
+        uint8_t* charmodes = &qr->charmodes[i * JC_QRE_NUM_AUTO_MODES];
+
+        uint32_t char_start = char_remaining == 0;
+        if( char_start )
+        {
+            uint32_t codepoint;
+            char_remaining = _jc_qre_utf8_decode(&input[i], inputlength - i, &codepoint);
+            char_is_kanji = kanji && codepoint >= 0x3000 && _jc_qre_kanji_value(codepoint) != 0xFFFFFFFF;
+        }
+        char_remaining--;
+        uint32_t char_end = char_remaining == 0;
+
+        uint32_t valid[JC_QRE_NUM_AUTO_MODES] = { _jc_qre_is_numeric(c), _jc_qre_is_alphanumeric(c), 1, char_is_kanji };
+
+        // Encode the character in each mode
+        uint32_t charcosts[JC_QRE_NUM_AUTO_MODES];
+        for( uint32_t m = 0; m < JC_QRE_NUM_AUTO_MODES; ++m )
+        {
+            uint32_t charcost = (m == JC_QRE_INPUT_TYPE_KANJI && !char_start) ? 0 : char_costs[m];
+            charcosts[m] = (valid[m] && costs[m] != infinity) ? costs[m] + charcost : infinity;
+            costs[m] = charcosts[m];
+            charmodes[m] = (uint8_t)m;
+        }
+
+        // Or, switch to another mode after this character
+        for( uint32_t to = 0; to < JC_QRE_NUM_AUTO_MODES; ++to )
+        {
+            for( uint32_t from = 0; from < JC_QRE_NUM_AUTO_MODES; ++from )
+            {
+                if( from == to || charcosts[from] == infinity )
+                    continue;
+                if( !char_end && (from == JC_QRE_INPUT_TYPE_KANJI || to == JC_QRE_INPUT_TYPE_KANJI) )
+                    continue;
+                uint32_t cost = (charcosts[from] + 5) / 6 * 6 + head_costs[to];
+                if( cost < costs[to] )
+                {
+                    costs[to] = cost;
+                    charmodes[to] = (uint8_t)from;
+                }
+            }
+        }
+    }
+
+    uint32_t mode = 0;
+    for( uint32_t m = 1; m < JC_QRE_NUM_AUTO_MODES; ++m )
+    {
+        if( costs[m] < costs[mode] )
+            mode = m;
+    }
+
+    // Walk back, and store the mode of each character in the first slot (which is no longer needed)
+    for( uint32_t i = inputlength; i > 0; --i )
+    {
+        uint8_t* charmodes = &qr->charmodes[(i-1) * JC_QRE_NUM_AUTO_MODES];
+        mode = charmodes[mode];
+        charmodes[0] = (uint8_t)mode;
     }
 
+    uint32_t start = 0;
+    for( uint32_t i = 1; i <= inputlength; ++i )
+    {
+        uint8_t type = qr->charmodes[start * JC_QRE_NUM_AUTO_MODES];
+        if( i < inputlength && qr->charmodes[i * JC_QRE_NUM_AUTO_MODES] == type )
+            continue;
+        if( _jc_qre_add_segment(qr, type, &input[start], i - start) == 0xFFFFFFFF )
+            return 0xFFFFFFFF;
+        start = i;
+    }
     return 0;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Reed-Solomon functions
 
-static uint8_t _jc_qre_rs_multiply(uint8_t x, uint8_t y)
+// GF(256) with the QR code polynomial 0x11D
+// The antilog table is doubled, so that the sum of two logarithms can be used as an index directly
+static const uint8_t JC_QRE_GF_EXP[510] = {
+   1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
+  76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
+ 157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
+  70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
+  95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
+ 253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
+ 217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
+ 129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
+ 133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
+ 168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
+ 230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+ 227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
+ 130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
+  81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
+  18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
+  44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,   1,
+   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,  76,
+ 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192, 157,
+  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,  70,
+ 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,  95,
+ 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240, 253,
+ 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226, 217,
+ 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206, 129,
+  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204, 133,
+  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84, 168,
+  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115, 230,
+ 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255, 227,
+ 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65, 130,
+  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,  81,
+ 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,  18,
+  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,  44,
+  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142,
+};
+
+// JC_QRE_GF_LOG[0] is undefined
+static const uint8_t JC_QRE_GF_LOG[256] = {
+   0,   0,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
+   4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
+   5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
+  29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
+   6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
+  54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
+  30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
+ 202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
+   7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
+ 227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
+  55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
+ 242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
+  31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
+ 108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
+ 203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
+  79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175,
+};
+
+static inline uint8_t _jc_qre_rs_multiply(uint8_t x, uint8_t y)
 {
-    int32_t v = 0;
-    for( int32_t i = 7; i >= 0; --i )
-    {
-        v = (v << 1) ^ ( (v >> 7) * 0x11D ); // Do modulo 0x11D if it overflows
-        v ^= ((y >> i) & 1) * x;            // Only if y is odd
-    }
-    return (uint8_t)v;
+    if( x == 0 || y == 0 )
+        return 0;
+    return JC_QRE_GF_EXP[ JC_QRE_GF_LOG[x] + JC_QRE_GF_LOG[y] ];
 }
 
 // the generator [out] must have the size 'length'
+// The coefficients are stored as logarithms. None of the generators used by the QR code versions have a zero coefficient.
 static void _jc_qre_rs_create_generator(uint32_t length, uint8_t* coefficients)
 {
     for( uint32_t i = 0; i < length; ++i )
@@ -507,46 +1818,63 @@ static void _jc_qre_rs_create_generator(uint32_t length, uint8_t* coefficients)
     }
     coefficients[length-1] = 1;
 
-    uint32_t power = 1;
+    // multiply by (x - a^i)
     for( uint32_t i = 0; i < length; ++i )
     {
+        uint8_t power = JC_QRE_GF_EXP[i];
         for( uint32_t j = 0; j < length; ++j )
         {
-            coefficients[j] = _jc_qre_rs_multiply(coefficients[j], (uint8_t)power);
+            coefficients[j] = _jc_qre_rs_multiply(coefficients[j], power);
             if( (j + 1) < length )
                 coefficients[j] ^= coefficients[j+1];
         }
-        uint32_t overflow = (power >> 7);           // If it became > 255, this is 1...
-        power = (power << 1) ^ (overflow * 0x11D);  // ...in which case, we should do the modulo
     }
+
+    for( uint32_t i = 0; i < length; ++i )
+    {
+        coefficients[i] = JC_QRE_GF_LOG[coefficients[i]];
+    }
+}
+
+// Gets the generator from the context, and builds it the first time it is used
+static const uint8_t* _jc_qre_rs_get_generator(JCQRCodeInternal* qr, uint32_t length)
+{
+    uint8_t* coefficients = qr->rs_generators[length];
+    if( (qr->rs_generators_built & (1u << length)) == 0 )
+    {
+        _jc_qre_rs_create_generator(length, coefficients);
+        qr->rs_generators_built |= 1u << length;
+    }
+    return coefficients;
 }
 
 // length: length of coefficients
-// coefficients: the rs generator coefficients
+// coefficients: the rs generator coefficients (as logarithms)
 // datasize: the number of data code words
 // data: the data code words
 // out: the remainder coefficients
 static void _jc_qre_rs_encode(uint32_t length, const uint8_t* coefficients, uint32_t datasize, const uint8_t* data, uint8_t* out)
 {
-    for( uint32_t i = 0; i < length; ++i )
-    {
-        out[i] = 0;
-    }
+    // Instead of shifting the remainder one step for each data code word, we slide a window over a larger buffer.
+    // At step i, the remainder is stored in remainder[i, i+length)
+    uint8_t remainder[JC_QRE_MAX_BLOCK_CODEWORDS];
+    memset(remainder, 0, datasize + length);
 
     for( uint32_t i = 0; i < datasize; ++i )
     {
-        uint32_t value = data[i] ^ out[0];
-        // shift all elements one step
-        for( uint32_t j = 1; j < length; ++j )
-        {
-            out[j-1] = out[j];
-        }
-        out[length-1] = 0;
+        uint8_t value = data[i] ^ remainder[i];
+        if( value == 0 )
+            continue;
+
+        uint32_t logvalue = JC_QRE_GF_LOG[value];
+        uint8_t* r = &remainder[i+1];
         for( uint32_t j = 0; j < length; ++j )
         {
-            out[j] ^= _jc_qre_rs_multiply(coefficients[j], (uint8_t)value);
+            r[j] ^= JC_QRE_GF_EXP[coefficients[j] + logvalue];
         }
     }
+
+    memcpy(out, &remainder[datasize], length);
 }
 
 static void _jc_qre_calc_error_correction(JCQRCodeInternal* qr)
@@ -554,8 +1882,7 @@ static void _jc_qre_calc_error_correction(JCQRCodeInternal* qr)
     uint32_t index = JC_QRE_INDEX(qr->qrcode.ecl, qr->qrcode.version);
     uint32_t num_ec_codewords_per_block = JC_QRE_ERROR_CORRECTION_CODEWORD_COUNT[index];
 
-    uint8_t coefficients[64]; // generator
-    _jc_qre_rs_create_generator(num_ec_codewords_per_block, coefficients);
+    const uint8_t* coefficients = _jc_qre_rs_get_generator(qr, num_ec_codewords_per_block);
 
     uint32_t num_ec_codewords_total = 0;
     uint32_t data_offset = 0;
@@ -636,22 +1963,49 @@ static void _jc_qre_interleave_codewords(JCQRCodeInternal* qr)
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+static inline uint32_t _jc_qre_count_trailing_zeros(uint64_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctzll(v);
+#else
+    uint32_t n = 0;
+    while( (v & 1) == 0 )
+    {
+        v >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+static inline void _jc_qre_set_line_bit(uint64_t* line, uint32_t i, uint32_t value)
+{
+    uint32_t bit = i + JC_QRE_LINE_OFFSET;
+    uint64_t mask = (uint64_t)1 << (bit & 63);
+    line[bit >> 6] = value ? (line[bit >> 6] | mask) : (line[bit >> 6] & ~mask);
+}
+static inline uint32_t _jc_qre_get_line_bit(const uint64_t* line, uint32_t i)
+{
+    uint32_t bit = i + JC_QRE_LINE_OFFSET;
+    return (uint32_t)(line[bit >> 6] >> (bit & 63)) & 1;
+}
+
 static inline void _jc_qre_draw_module(JCQRCodeInternal* qr, int32_t x, int32_t y, uint8_t black)
 {
-    qr->image[y * 256 + x] = black ? 0 : 255;
+    _jc_qre_set_line_bit(&qr->modules[y * qr->stride], x, black);
 }
-static inline uint8_t _jc_qre_get_module(JCQRCodeInternal* qr, int32_t x, int32_t y)
+static inline uint32_t _jc_qre_get_module(JCQRCodeInternal* qr, int32_t x, int32_t y)
 {
-    return qr->image[y * 256 + x];
+    return _jc_qre_get_line_bit(&qr->modules[y * qr->stride], x);
 }
 static inline void _jc_qre_draw_function_module(JCQRCodeInternal* qr, int32_t x, int32_t y, uint8_t black)
 {
-    qr->image[y * 256 + x] = black ? 0 : 255;
-    qr->image_fun[y * 256 + x] = 1;
+    _jc_qre_set_line_bit(&qr->modules[y * qr->stride], x, black);
+    _jc_qre_set_line_bit(&qr->function[y * qr->stride], x, 1);
 }
 static inline uint32_t _jc_qre_is_function_module(JCQRCodeInternal* qr, int32_t x, int32_t y)
 {
-    return qr->image_fun[y * 256 + x] != 0 ? 1 : 0;
+    return _jc_qre_get_line_bit(&qr->function[y * qr->stride], x);
 }
 
 static void _jc_qre_draw_finder_pattern(JCQRCodeInternal* qr, int32_t x, int32_t y)
@@ -697,41 +2051,48 @@ static void _jc_qre_draw_alignment_pattern(JCQRCodeInternal* qr, int32_t x, int3
 }
 
 
-static void _jc_qre_draw_data(JCQRCodeInternal* qr)
+// Finds the data modules, in the order the bits are placed.
+// The columns are walked in pairs, from the right, alternating upwards and downwards, skipping the function modules
+static void _jc_qre_build_placements(JCQRCodeInternal* qr)
 {
     uint32_t size = qr->qrcode.size;
-
-    uint32_t bitindex = 0;
+    uint32_t count = 0;
 
     uint32_t upwards = 1;
-    uint32_t x = size - 1;
-
-/*
-    printf("qr->interleavedsize * 8: %u\n", qr->interleavedsize * 8);
-
-    print_bits("byte 0: ", qr->interleaved[0], 8);
-    print_bits("byte 1: ", qr->interleaved[1], 8);
-    print_bits("byte 2: ", qr->interleaved[2], 8);
-    print_bits("byte 3: ", qr->interleaved[3], 8);
-*/
-
-    while( bitindex < qr->interleavedsize * 8 )
+    for( int32_t x = (int32_t)size - 1; x > 0; x -= 2 )
     {
+        if( x == 6 )
+            x = 5; // skip the vertical timing pattern
+
         for( uint32_t i = 0; i < size * 2; ++i )
         {
-            uint32_t xx = x - (i & 1);
+            uint32_t xx = (uint32_t)x - (i & 1);
             uint32_t y = upwards ? size - 1 - (i >> 1) : (i >> 1);
 
-            if(!_jc_qre_is_function_module(qr, xx, y))
-            {
-                uint32_t bit = _jc_qre_bitbuffer_read(qr->interleaved, qr->interleavedsize, &bitindex, 1);
-                _jc_qre_draw_module(qr, xx, y, bit != 0);
-            }
+            if( !_jc_qre_is_function_module(qr, xx, y) )
+                qr->placements[count++] = (uint16_t)((y << 8) | xx);
         }
         upwards ^= 1;
-        x -= 2;
-        if( x == 6 )
-            x = 5;
+    }
+    qr->num_placements = count;
+}
+
+// Places the interleaved code words in the data modules. The modules are expected to be cleared
+static void _jc_qre_draw_data(JCQRCodeInternal* qr)
+{
+    uint32_t stride = qr->stride;
+    const uint16_t* placements = qr->placements;
+    for( uint32_t i = 0; i < qr->interleavedsize; ++i, placements += 8 )
+    {
+        uint32_t byte = qr->interleaved[i];
+        while( byte )
+        {
+            // visit the set bits only (most significant bit first)
+            uint32_t bit = 7 - _jc_qre_count_trailing_zeros(byte);
+            uint32_t pos = placements[bit];
+            _jc_qre_set_line_bit(&qr->modules[(pos >> 8) * stride], pos & 0xFF, 1);
+            byte &= byte - 1;
+        }
     }
 }
 
@@ -775,43 +2136,40 @@ static void _jc_qre_draw_finder_patterns(JCQRCodeInternal* qr)
     _jc_qre_draw_function_module(qr, 8, (4 * qr->qrcode.version) + 9, 1);
 }
 
-static void _jc_qre_draw_format(JCQRCodeInternal* qr, uint32_t pattern_mask)
+// Gets the position of a format bit (0-14), in the first (0) or second (1) copy
+static inline void _jc_qre_get_format_position(uint32_t size, uint32_t bit, uint32_t copy, uint32_t* x, uint32_t* y)
 {
-    uint32_t size = qr->qrcode.size;
-    uint32_t format = JC_QRE_FORMAT_BITS[qr->qrcode.ecl * 8 + pattern_mask];
-
-/*
-printf("version: %u  ecl: %d\n", qr->qrcode.version, qr->qrcode.ecl);
-printf("pattern_mask: %u\n", pattern_mask);
-    printf("format: %u, 0x%08x\n", format, format);
-    print_bits("format:", format, 15);
-*/
-    // top right
-    for( uint32_t i = 0; i < 8; ++i )
+    if( copy == 0 )
     {
-        _jc_qre_draw_function_module(qr, size - 1 - i, 8, (format >> i) & 1);
+        // top left
+        if( bit < 6 )       { *x = 8; *y = bit; }
+        else if( bit < 8 )  { *x = 8; *y = bit + 1; }
+        else if( bit == 8 ) { *x = 7; *y = 8; }
+        else                { *x = 14 - bit; *y = 8; }
     }
-    // bottom left
-    for( uint32_t i = 0; i < 7; ++i )
+    else
     {
-        _jc_qre_draw_function_module(qr, 8, size - 7 + i, (format >> (8+i)) & 1);
+        // top right, then bottom left
+        if( bit < 8 )       { *x = size - 1 - bit; *y = 8; }
+        else                { *x = 8; *y = size - 15 + bit; }
     }
+}
 
-    // top left -- right side
-    for( uint32_t i = 0; i < 6; ++i )
+static void _jc_qre_draw_format(JCQRCodeInternal* qr, uint32_t pattern_mask)
+{
+    uint32_t size = qr->qrcode.size;
+    uint32_t format = JC_QRE_FORMAT_BITS[qr->qrcode.ecl * 8 + pattern_mask];
+
+    for( uint32_t i = 0; i < 15; ++i )
     {
-        _jc_qre_draw_function_module(qr, 8, i, (format >> i) & 1);
+        for( uint32_t copy = 0; copy < 2; ++copy )
+        {
+            uint32_t x, y;
+            _jc_qre_get_format_position(size, i, copy, &x, &y);
+            _jc_qre_draw_function_module(qr, x, y, (format >> i) & 1);
+        }
     }
-
-    _jc_qre_draw_function_module(qr, 8, 7, (format >> 6) & 1);
-    _jc_qre_draw_function_module(qr, 8, 8, (format >> 7) & 1);
-    _jc_qre_draw_function_module(qr, 7, 8, (format >> 8) & 1);
-
-    for( uint32_t i = 0; i < 6; ++i )
-    {
-        _jc_qre_draw_function_module(qr, 5 - i, 8, (format >> (9 + i))  & 1);
-    }
-}
+}
 
 static inline uint32_t _jc_qre_is_masked(uint32_t x, uint32_t y, uint32_t pattern_mask)
 {
@@ -822,144 +2180,255 @@ static inline uint32_t _jc_qre_is_masked(uint32_t x, uint32_t y, uint32_t patter
         case 2: return (x % 3) == 0;
         case 3: return ((x + y) % 3) == 0;
         case 4: return ((x / 3 + y / 2) & 1) == 0;
-        case 5: return ((x * y) & 1 + (x * y) % 3) == 0;
-        case 6: return (((x * y) & 1 + (x * y) % 3) & 1) == 0;
-        case 7: return (((x + y) & 1 + (x * y) % 3) & 1) == 0;
+        case 5: return (((x * y) & 1) + (x * y) % 3) == 0;
+        case 6: return ((((x * y) & 1) + (x * y) % 3) & 1) == 0;
+        case 7: return ((((x + y) & 1) + (x * y) % 3) & 1) == 0;
         default: return 0;
     }
 }
 
-static void _jc_qre_draw_mask(JCQRCodeInternal* qr, uint32_t pattern_mask)
+static inline uint32_t _jc_qre_popcount(uint64_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_popcountll(v);
+#else
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (uint32_t)((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Gets word 'w' of the line, shifted so that bit i holds the module at i+n (n < 64)
+static inline uint64_t _jc_qre_line_shr(const uint64_t* line, uint32_t w, uint32_t n)
+{
+    return n ? ((line[w] >> n) | (line[w+1] << (64 - n))) : line[w];
+}
+
+// Gets word 'w' of the line, shifted so that bit i holds the module at i-1
+static inline uint64_t _jc_qre_line_shl1(const uint64_t* line, uint32_t w)
+{
+    return (line[w] << 1) | (w ? line[w-1] >> 63 : 0);
+}
+
+// Transposes the lines (or their inverse) into columns
+static void _jc_qre_transpose_lines(JCQRCodeInternal* qr, const uint64_t* lines, uint64_t* cols, uint32_t invert)
 {
     uint32_t size = qr->qrcode.size;
+    uint32_t stride = qr->stride;
+    memset(cols, 0, sizeof(cols[0]) * size * stride);
     for( uint32_t y = 0; y < size; ++y )
     {
-        for( uint32_t x = 0; x < size; ++x )
+        const uint64_t* row = &lines[y * stride];
+        uint32_t ybit = y + JC_QRE_LINE_OFFSET;
+        uint64_t ymask = (uint64_t)1 << (ybit & 63);
+        for( uint32_t w = 0; w < stride - 1; ++w )
         {
-            if(_jc_qre_is_function_module(qr, x, y))
+            // visit the set bits only
+            uint64_t bits = (invert ? ~row[w] : row[w]) & qr->valid[w];
+            while( bits )
             {
-                continue;
+                uint32_t x = w * 64 + _jc_qre_count_trailing_zeros(bits) - JC_QRE_LINE_OFFSET;
+                cols[x * stride + (ybit >> 6)] |= ymask;
+                bits &= bits - 1;
             }
-            if(_jc_qre_is_masked(x, y, pattern_mask))
-                qr->image[y * 256 + x] ^= 255;
         }
     }
 }
 
-static inline uint32_t _jc_qre_calc_penalty(JCQRCodeInternal* qr)
+// Transposes the modules into columns. The data columns are part of the template
+static void _jc_qre_pack_columns(JCQRCodeInternal* qr)
 {
-    uint32_t size = qr->qrcode.size;
-    uint32_t penalty = 0;
+    _jc_qre_transpose_lines(qr, qr->modules, qr->base_cols, 0);
+}
 
-    // 5 or more in a row
-    for( uint32_t y = 0; y < size; ++y )
+// The mask patterns repeat every 12 rows (and columns), so the masks of all rows are stored as 12 lines per mask.
+// The lines span the largest version, and are limited to the data modules of the symbol when used.
+static void _jc_qre_build_mask_planes(JCQRCodeInternal* qr)
+{
+    if( qr->mask_planes_built )
+        return;
+    memset(qr->mask_rows, 0, sizeof(qr->mask_rows));
+    memset(qr->mask_cols, 0, sizeof(qr->mask_cols));
+    for( uint32_t m = 0; m < 8; ++m )
     {
-        uint8_t color = _jc_qre_get_module(qr, 0, y);
-        uint32_t consecutive = 1;
-        for( uint32_t x = 1; x < size; ++x )
+        for( uint32_t phase = 0; phase < JC_QRE_MASK_PERIOD; ++phase )
         {
-            uint8_t nextcolor = _jc_qre_get_module(qr, x, y);
-            if( color == nextcolor )
+            for( uint32_t i = 0; i < JC_QRE_MAX_SIZE; ++i )
             {
-                consecutive++;
-            }
-            else
-            {
-                color = nextcolor;
-                penalty += consecutive >= 5 ? 3 + (consecutive-5) : 0;
-                consecutive = 1;
+                uint32_t bit = i + JC_QRE_LINE_OFFSET;
+                qr->mask_rows[m][phase][bit >> 6] |= (uint64_t)_jc_qre_is_masked(i, phase, m) << (bit & 63);
+                qr->mask_cols[m][phase][bit >> 6] |= (uint64_t)_jc_qre_is_masked(phase, i, m) << (bit & 63);
             }
         }
-        penalty += consecutive >= 5 ? 3 + (consecutive-5) : 0;
     }
-    // 5 or more in a column
-    for( uint32_t x = 0; x < size; ++x )
+    qr->mask_planes_built = 1;
+}
+
+static inline void _jc_qre_flip_line_module(JCQRCodeInternal* qr, uint32_t x, uint32_t y)
+{
+    uint32_t xbit = x + JC_QRE_LINE_OFFSET;
+    uint32_t ybit = y + JC_QRE_LINE_OFFSET;
+    qr->rows[y * qr->stride + (xbit >> 6)] ^= (uint64_t)1 << (xbit & 63);
+    qr->cols[x * qr->stride + (ybit >> 6)] ^= (uint64_t)1 << (ybit & 63);
+}
+
+// Creates the lines as they would look with the mask (and its format bits) applied, without touching the modules.
+// Expects the modules to have the format bits of mask 0 drawn, and the columns to be packed.
+static void _jc_qre_build_masked_lines(JCQRCodeInternal* qr, uint32_t pattern_mask)
+{
+    uint32_t size = qr->qrcode.size;
+    uint32_t stride = qr->stride;
+    for( uint32_t i = 0, phase = 0; i < size; ++i )
     {
-        uint8_t color = _jc_qre_get_module(qr, x, 0);
-        uint32_t consecutive = 1;
-        for( uint32_t y = 1; y < size; ++y )
+        const uint64_t* mask_row = qr->mask_rows[pattern_mask][phase];
+        const uint64_t* mask_col = qr->mask_cols[pattern_mask][phase];
+        uint32_t offset = i * stride;
+        for( uint32_t w = 0; w < stride; ++w )
         {
-            uint8_t nextcolor = _jc_qre_get_module(qr, x, y);
-            if( color == nextcolor )
-            {
-                consecutive++;
-            }
-            else
-            {
-                color = nextcolor;
-                penalty += consecutive >= 5 ? 3 + (consecutive-5) : 0;
-                consecutive = 1;
-            }
+            uint64_t data_row = ~qr->function[offset + w] & qr->valid[w];
+            qr->rows[offset + w] = qr->modules[offset + w] ^ (mask_row[w] & data_row);
+            qr->cols[offset + w] = qr->base_cols[offset + w] ^ (mask_col[w] & qr->data_cols[offset + w]);
         }
-        penalty += consecutive >= 5 ? 3 + (consecutive-5) : 0;
+        if( ++phase == JC_QRE_MASK_PERIOD )
+            phase = 0;
     }
 
-/*
-    // find 2x2 blocks of same color
-    for( uint32_t y = 0; y < size-1; ++y )
+    uint32_t format_diff = JC_QRE_FORMAT_BITS[qr->qrcode.ecl * 8 + pattern_mask] ^ JC_QRE_FORMAT_BITS[qr->qrcode.ecl * 8];
+    for( uint32_t i = 0; i < 15; ++i )
     {
-        for( uint32_t x = 0; x < size-1; ++x )
+        if( ((format_diff >> i) & 1) == 0 )
+            continue;
+        for( uint32_t copy = 0; copy < 2; ++copy )
         {
-            uint8_t color1 = _jc_qre_get_module(qr, x, y);
-            uint8_t color2 = _jc_qre_get_module(qr, x+1, y);
-            uint8_t color3 = _jc_qre_get_module(qr, x, y+1);
-            uint8_t color4 = _jc_qre_get_module(qr, x+1, y+1);
-            penalty += (color1 & color2 & color3 & color4 & 1) * 3;
+            uint32_t x, y;
+            _jc_qre_get_format_position(size, i, copy, &x, &y);
+            _jc_qre_flip_line_module(qr, x, y);
         }
     }
+}
 
-    // find special patterns
-    uint32_t mask = (1 << 12) - 1;
-    uint32_t pattern1 = 0x5d0; // 11 bits long
-    uint32_t pattern2 = 0x5d;
-    for( uint32_t y = 0; y < size; ++y )
+// Rule 1: Runs of 5 or more modules of the same color score 3 + (length - 5)
+// Rule 3: The finder like patterns 1011101 with 4 light modules on either side score 40 each
+static uint32_t _jc_qre_calc_penalty_line(const uint64_t* dark, const uint64_t* valid, uint32_t numwords)
+{
+    uint64_t light[JC_QRE_LINE_WORDS];
+    uint64_t same[JC_QRE_LINE_WORDS];
+    uint64_t run[JC_QRE_LINE_WORDS];
+    for( uint32_t w = 0; w < numwords; ++w )
     {
-        uint32_t bits = 0;
-        for( uint32_t x = 0; x < 11; ++x )
-        {
-            bits = bits << 1 | (_jc_qre_get_module(qr, x, y) & 1);
-        }
-        for( uint32_t x = 11; x < size; ++x )
+        light[w] = ~dark[w];
+        // bit i is set if the modules i and i+1 have the same color
+        same[w] = ~(dark[w] ^ _jc_qre_line_shr(dark, w, 1)) & valid[w] & _jc_qre_line_shr(valid, w, 1);
+    }
+    light[numwords] = ~(uint64_t)0;
+    same[numwords] = 0;
+
+    // bit i is set if the modules [i, i+4] have the same color
+    for( uint32_t w = 0; w < numwords; ++w )
+    {
+        run[w] = same[w] & _jc_qre_line_shr(same, w, 1) & _jc_qre_line_shr(same, w, 2) & _jc_qre_line_shr(same, w, 3);
+    }
+    run[numwords] = 0;
+
+    uint32_t penalty = 0;
+    for( uint32_t w = 0; w < numwords; ++w )
+    {
+        // A run of length n sets n-4 bits, and it starts where the previous bit is clear
+        uint64_t starts = run[w] & ~_jc_qre_line_shl1(run, w);
+        penalty += _jc_qre_popcount(run[w]) + 2 * _jc_qre_popcount(starts);
+
+        uint64_t core = _jc_qre_line_shr(dark, w, 0) & _jc_qre_line_shr(light, w, 1) & _jc_qre_line_shr(dark, w, 2) &
+                        _jc_qre_line_shr(dark, w, 3) & _jc_qre_line_shr(dark, w, 4) & _jc_qre_line_shr(light, w, 5) &
+                        _jc_qre_line_shr(dark, w, 6);
+        uint64_t trailing = _jc_qre_line_shr(light, w, 7) & _jc_qre_line_shr(light, w, 8) & _jc_qre_line_shr(light, w, 9) & _jc_qre_line_shr(light, w, 10);
+        penalty += 40 * _jc_qre_popcount(core & trailing);
+
+        // the patterns preceded by light modules are found by looking at the core 4 steps further ahead
+        uint64_t leading = _jc_qre_line_shr(light, w, 0) & _jc_qre_line_shr(light, w, 1) & _jc_qre_line_shr(light, w, 2) & _jc_qre_line_shr(light, w, 3);
+        uint64_t core4 = _jc_qre_line_shr(dark, w, 4) & _jc_qre_line_shr(light, w, 5) & _jc_qre_line_shr(dark, w, 6) &
+                         _jc_qre_line_shr(dark, w, 7) & _jc_qre_line_shr(dark, w, 8) & _jc_qre_line_shr(light, w, 9) &
+                         _jc_qre_line_shr(dark, w, 10);
+        penalty += 40 * _jc_qre_popcount(leading & core4);
+    }
+    return penalty;
+}
+
+// Scores the packed lines using the four penalty rules in ISO/IEC 18004 (7.8.3)
+static uint32_t _jc_qre_calc_penalty(JCQRCodeInternal* qr)
+{
+    uint32_t size = qr->qrcode.size;
+    uint32_t stride = qr->stride;
+    uint32_t numwords = stride - 1;
+    const uint64_t* valid = qr->valid;
+
+    uint32_t penalty = 0;
+    uint32_t num_dark = 0;
+    for( uint32_t i = 0; i < size; ++i )
+    {
+        penalty += _jc_qre_calc_penalty_line(&qr->rows[i * stride], valid, numwords);
+        penalty += _jc_qre_calc_penalty_line(&qr->cols[i * stride], valid, numwords);
+        for( uint32_t w = 0; w < numwords; ++w )
         {
-            bits = ((bits << 1) & mask) | (_jc_qre_get_module(qr, x, y) & 1);
-            penalty += (bits == pattern1 || bits == pattern2) ? 40 : 0;
+            num_dark += _jc_qre_popcount(qr->rows[i * stride + w]);
         }
     }
 
-    for( uint32_t x = 0; x < size; ++x )
+    // Rule 2: Each 2x2 block of the same color scores 3
+    for( uint32_t y = 0; y < size - 1; ++y )
     {
-        uint32_t bits = 0;
-        for( uint32_t y = 0; y < 11; ++y )
+        const uint64_t* row0 = &qr->rows[y * stride];
+        const uint64_t* row1 = &qr->rows[(y+1) * stride];
+        for( uint32_t w = 0; w < numwords; ++w )
         {
-            bits = bits << 1 | (_jc_qre_get_module(qr, x, y) & 1);
+            uint64_t vertical = ~(row0[w] ^ row1[w]);
+            uint64_t horizontal = ~(row0[w] ^ _jc_qre_line_shr(row0, w, 1));
+            uint64_t block = vertical & horizontal & ~(_jc_qre_line_shr(row1, w, 0) ^ _jc_qre_line_shr(row1, w, 1));
+            penalty += 3 * _jc_qre_popcount(block & valid[w] & _jc_qre_line_shr(valid, w, 1));
         }
-        for( uint32_t y = 11; y < size; ++y )
+    }
+
+    // Rule 4: Score 10 for each 5% step away from a 50% dark ratio
+    uint32_t total = size * size;
+    // the size is odd, so the deviation is never zero
+    uint32_t deviation = num_dark * 20 > total * 10 ? num_dark * 20 - total * 10 : total * 10 - num_dark * 20;
+    uint32_t k = (deviation + total - 1) / total - 1;
+    penalty += k * 10;
+
+    return penalty;
+}
+
+static void _jc_qre_draw_mask(JCQRCodeInternal* qr, uint32_t pattern_mask)
+{
+    uint32_t size = qr->qrcode.size;
+    uint32_t stride = qr->stride;
+    for( uint32_t y = 0, phase = 0; y < size; ++y )
+    {
+        const uint64_t* mask_row = qr->mask_rows[pattern_mask][phase];
+        uint64_t* row = &qr->modules[y * stride];
+        const uint64_t* fun = &qr->function[y * stride];
+        for( uint32_t w = 0; w < stride; ++w )
         {
-            bits = ((bits << 1) & mask) | (_jc_qre_get_module(qr, x, y) & 1);
-            penalty += (bits == pattern1 || bits == pattern2) ? 40 : 0;
+            row[w] ^= mask_row[w] & ~fun[w] & qr->valid[w];
         }
+        if( ++phase == JC_QRE_MASK_PERIOD )
+            phase = 0;
     }
+}
 
-    int32_t num_black = 0;
+// Writes the modules to the output image
+static void _jc_qre_expand_image(JCQRCodeInternal* qr)
+{
+    uint32_t size = qr->qrcode.size;
     for( uint32_t y = 0; y < size; ++y )
     {
+        const uint64_t* row = &qr->modules[y * qr->stride];
+        uint8_t* out = &qr->image[y * size];
         for( uint32_t x = 0; x < size; ++x )
         {
-            num_black += _jc_qre_get_module(qr, x, y) & 1;
+            out[x] = _jc_qre_get_line_bit(row, x) ? 0 : 255;
         }
     }
-    int32_t ratio = (num_black * 100) / (size*size);
-    int32_t multiples_of_5 = ratio / 5;
-    int32_t value1 = (multiples_of_5 * 5) - 50;
-    int32_t value2 = value1 + 5;
-    value1 = value1 < 0 ? -value1 : value1;
-    value2 = value2 < 0 ? -value2 : value2;
-    value1 = value1 / 5;
-    value2 = value2 / 5;
-    penalty += ((value1 < value2) ? value1 : value2) * 10;
-*/
-
-    return penalty;
 }
 
 static void _jc_qre_draw_version(JCQRCodeInternal* qr)
@@ -984,35 +2453,65 @@ static void _jc_qre_draw_version(JCQRCodeInternal* qr)
     }
 }
 
+// Draws the function patterns of the version, and finds the data modules
+static void _jc_qre_build_template(JCQRCodeInternal* qr)
+{
+    // Only clear the area covered by this version
+    uint32_t size = qr->qrcode.size;
+    qr->stride = (size + JC_QRE_LINE_OFFSET + 63) / 64 + 1;
+    memset(qr->modules, 0, sizeof(qr->modules[0]) * size * qr->stride);
+    memset(qr->function, 0, sizeof(qr->function[0]) * size * qr->stride);
+    memset(qr->valid, 0, sizeof(qr->valid));
+    for( uint32_t i = 0; i < size; ++i )
+    {
+        _jc_qre_set_line_bit(qr->valid, i, 1);
+    }
+
+    _jc_qre_draw_finder_patterns(qr);
+    _jc_qre_draw_format(qr, 0); // reserve area (the bits are drawn for each code)
+    _jc_qre_draw_version(qr);
+
+    _jc_qre_build_placements(qr);
+    _jc_qre_transpose_lines(qr, qr->function, qr->data_cols, 1);
+    memcpy(qr->template_modules, qr->modules, sizeof(qr->modules[0]) * size * qr->stride);
+    qr->template_version = qr->qrcode.version;
+}
+
 static void _jc_qre_draw_image(JCQRCodeInternal* qr)
 {
-    memset(qr->image, 255, sizeof(qr->image));
-    memset(qr->image_fun, 0, sizeof(qr->image_fun));
     qr->qrcode.data = qr->image;
     qr->qrcode.size = (qr->qrcode.version-1)*4 + 21;
+    qr->qrcode.stride = qr->qrcode.size;
 
-    _jc_qre_draw_finder_patterns(qr);
-    _jc_qre_draw_format(qr, 0); // reserve area
-    _jc_qre_draw_version(qr); // reserve area
+    if( qr->template_version != qr->qrcode.version )
+        _jc_qre_build_template(qr);
+    else
+        memcpy(qr->modules, qr->template_modules, sizeof(qr->modules[0]) * qr->qrcode.size * qr->stride);
 
+    _jc_qre_draw_format(qr, 0);
     _jc_qre_draw_data(qr);
 
-    // apply masks and find the best one
-    uint32_t best_mask = 0;
+    // Score all masks on the packed lines, and only draw the best one
+    _jc_qre_build_mask_planes(qr);
 
-    uint32_t lowest_score = 0xFFFFFFFF;
-    for( uint32_t i = 0; i < 8; ++i )
+    uint32_t best_mask = qr->mask;
+    if( best_mask == JC_QRE_MASK_AUTO )
     {
-        _jc_qre_draw_format(qr, i);
-        _jc_qre_draw_mask(qr, i);
-        uint32_t score = _jc_qre_calc_penalty(qr);
+        _jc_qre_pack_columns(qr);
 
-        if( score < lowest_score )
+        best_mask = 0;
+        uint32_t lowest_score = 0xFFFFFFFF;
+        for( uint32_t i = 0; i < 8; ++i )
         {
-            best_mask = i;
-            lowest_score = score;
+            _jc_qre_build_masked_lines(qr, i);
+            uint32_t score = _jc_qre_calc_penalty(qr);
+
+            if( score < lowest_score )
+            {
+                best_mask = i;
+                lowest_score = score;
+            }
         }
-        _jc_qre_draw_mask(qr, i); // undo the mask (using xor)
     }
 
 // best_mask = 0;
@@ -1020,7 +2519,12 @@ static void _jc_qre_draw_image(JCQRCodeInternal* qr)
 
     _jc_qre_draw_format(qr, best_mask);
     _jc_qre_draw_mask(qr, best_mask);
-    _jc_qre_draw_version(qr);
+
+    qr->last_version = qr->qrcode.version;
+    qr->last_ecl = qr->qrcode.ecl;
+    qr->last_mask = best_mask;
+
+    _jc_qre_expand_image(qr);
 }
 
 
@@ -1035,74 +2539,52 @@ static inline uint32_t _jc_qre_get_total_bits(JCQRCodeInternal* qr, uint32_t ver
     {
         JCQRCodeSegment* seg = &qr->segments[i];
         uint32_t character_bit_count = JC_QRE_CHARACTER_COUNT_BIT_SIZE[JC_QRE_INDEX(seg->type, version)];
-        numbits += 4 + character_bit_count + seg->data.numbits;
+        if( seg->elementcount >= (1u << character_bit_count) )
+            return 0xFFFFFFFF; // the count doesn't fit
+        numbits += 4 + character_bit_count + seg->numbits;
     }
     return numbits;
 }
 
-static JCQRCode* _jc_qrencode_internal(JCQRCodeInternal* qr)
+// Writes the segments, the terminator and the padding into the data code words
+static void _jc_qre_write_data(JCQRCodeInternal* qr)
 {
-
     uint32_t capacity_bits = JC_QRE_DATA_CODEWORD_COUNT[ JC_QRE_INDEX(qr->qrcode.ecl, qr->qrcode.version) ] * 8;
 
-//printf("Writing segments\n");
-    uint32_t datasize = 0;
+    JCQRCodeBitWriter writer;
+    _jc_qre_bitwriter_init(&writer, qr->databuffer);
+
     for( uint32_t i = 0; i < qr->num_segments; ++i )
     {
         JCQRCodeSegment* seg = &qr->segments[i];
-        _jc_qre_bitbuffer_write(qr->databuffer, sizeof(qr->databuffer), &datasize, JC_QRE_TYPE_BITS[seg->type], 4);
-
-//print_bits("mode:", JC_QRE_TYPE_BITS[seg->type], 4);
-
-//printf("line: %d datasize %u\n", __LINE__, datasize);
-        _jc_qre_bitbuffer_write(qr->databuffer, sizeof(qr->databuffer), &datasize, seg->elementcount, JC_QRE_CHARACTER_COUNT_BIT_SIZE[JC_QRE_INDEX(seg->type, qr->qrcode.version)]);
-
-//print_bits("numchars:", seg->elementcount, JC_QRE_CHARACTER_COUNT_BIT_SIZE[JC_QRE_INDEX(seg->type, version)]);
-
-//printf("line: %d datasize %u\n", __LINE__, datasize);
-        _jc_qre_bitbuffer_append(qr->databuffer, sizeof(qr->databuffer), &datasize, seg->data.bits, seg->data.numbits);
-
-
-//printf("num bits:  %u\n", datasize);
-
-//print_bits("byte 0:", qr->databuffer[0], 8);
-//print_bits("byte 1:", qr->databuffer[1], 8);
-//print_bits("byte 2:", qr->databuffer[2], 8);
-//print_bits("byte 3:", qr->databuffer[3], 8);
-//print_bits("byte 4:", qr->databuffer[4], 8);
-
-
+        _jc_qre_bitwriter_write(&writer, JC_QRE_TYPE_BITS[seg->type], 4);
+        _jc_qre_bitwriter_write(&writer, seg->elementcount, JC_QRE_CHARACTER_COUNT_BIT_SIZE[JC_QRE_INDEX(seg->type, qr->qrcode.version)]);
+        _jc_qre_encode_segment(&writer, seg);
     }
 
-//printf("VERSION: %d   ECL: %d  capacity_bits: %d\n", qr->qrcode.version, qr->qrcode.ecl, capacity_bits);
-
-//printf("Writing terminator\n");
-
     // add terminator (max 4 zeros)
-    uint32_t terminator_length = capacity_bits - datasize;
+    uint32_t terminator_length = capacity_bits - _jc_qre_bitwriter_size(&writer);
     if( terminator_length > 4 )
         terminator_length = 4;
-    uint32_t zeros = 0;
-    if( terminator_length )
-    {
-        _jc_qre_bitbuffer_write(qr->databuffer, sizeof(qr->databuffer), &datasize, zeros, terminator_length);
-    }
+    _jc_qre_bitwriter_write(&writer, 0, terminator_length);
 
     // make it 8 bit aligned
-    uint32_t numpadzeros = (8 - (datasize & 0x7)) & 0x7;
-    _jc_qre_bitbuffer_write(qr->databuffer, sizeof(qr->databuffer), &datasize, zeros, numpadzeros);
+    _jc_qre_bitwriter_finish(&writer);
 
     // pad with bytes
     uint8_t padding[2] = { 0xEC, 0x11 };
-    uint32_t numpadbytes = (capacity_bits - datasize) / 8;
-
+    uint32_t numpadbytes = capacity_bits / 8 - writer.cursor;
     for( uint32_t i = 0; i < numpadbytes; ++i )
     {
-        _jc_qre_bitbuffer_write(qr->databuffer, sizeof(qr->databuffer), &datasize, padding[i&1], 8);
+        qr->databuffer[writer.cursor++] = padding[i&1];
     }
 
-    qr->datasize = datasize / 8;
+    qr->datasize = writer.cursor;
+}
 
+static JCQRCode* _jc_qrencode_internal(JCQRCodeInternal* qr)
+{
+    _jc_qre_write_data(qr);
     _jc_qre_calc_error_correction(qr);
     _jc_qre_interleave_codewords(qr);
     _jc_qre_draw_image(qr);
@@ -1110,89 +2592,367 @@ static JCQRCode* _jc_qrencode_internal(JCQRCodeInternal* qr)
     return (JCQRCode*)&qr->qrcode;
 }
 
-JCQRCode* jc_qrencode(const uint8_t* input, uint32_t inputlength)
+// Prepares a context for a new qr code
+static void _jc_qre_reset(JCQRCodeInternal* qr)
 {
-    JCQRCodeInternal* qr = (JCQRCodeInternal*)malloc( sizeof(JCQRCodeInternal) );
-    memset(qr, 0, sizeof(JCQRCodeInternal) );
+    memset(&qr->qrcode, 0, sizeof(qr->qrcode));
+    qr->num_segments = 0;
+    qr->datasize = 0;
+    qr->interleavedsize = 0;
+    qr->mask = JC_QRE_MASK_AUTO;
+}
+
+// The versions where the character count sizes change
+static const uint32_t JC_QRE_VERSION_CLASS_FIRST[] = { 1, 10, 27, 41 };
 
-    uint32_t result = _jc_qre_add_segment(qr, input, inputlength);
+static inline uint32_t _jc_qre_get_capacity_bits(uint32_t version, uint32_t ecl)
+{
+    return JC_QRE_DATA_CODEWORD_COUNT[ JC_QRE_INDEX(ecl, version) ] * 8;
+}
 
-    if( result == 0xFFFFFFFF )
+// Finds the smallest version in [first, last] that fits the current segments with the error correction level 'ecl',
+// and the highest error correction level within that version
+static uint32_t _jc_qre_select_version(JCQRCodeInternal* qr, uint32_t first, uint32_t last, uint32_t ecl)
+{
+    for( uint32_t i = 0; i < 3; ++i )
     {
-        // todo: error codes
-        free(qr);
+        uint32_t low = JC_QRE_VERSION_CLASS_FIRST[i];
+        uint32_t high = JC_QRE_VERSION_CLASS_FIRST[i+1] - 1;
+        if( low < first )
+            low = first;
+        if( high > last )
+            high = last;
+        if( low > high )
+            continue;
+
+        // The character count sizes are the same for all versions in the class, and so is the number of bits
+        uint32_t numbits = _jc_qre_get_total_bits(qr, low);
+        if( numbits > _jc_qre_get_capacity_bits(high, ecl) )
+            continue;
+
+        // The capacity grows with the version, so find the smallest version that fits with a binary search
+        while( low < high )
+        {
+            uint32_t mid = (low + high) / 2;
+            if( numbits <= _jc_qre_get_capacity_bits(mid, ecl) )
+                high = mid;
+            else
+                low = mid + 1;
+        }
+
+        qr->qrcode.version = low;
+        qr->qrcode.ecl = ecl;
+        for( uint32_t level = ecl + 1; level <= JC_QRE_ERROR_CORRECTION_LEVEL_HIGH; ++level )
+        {
+            if( numbits <= _jc_qre_get_capacity_bits(low, level) )
+                qr->qrcode.ecl = level;
+        }
+        return 1;
+    }
+    return 0;
+}
+
+// Checks that the current segments fit the version and error correction level
+static uint32_t _jc_qre_check_version(JCQRCodeInternal* qr, uint32_t version, uint32_t ecl)
+{
+    uint32_t numbits = _jc_qre_get_total_bits(qr, version);
+    if( numbits > _jc_qre_get_capacity_bits(version, ecl) )
         return 0;
+    qr->qrcode.version = version;
+    qr->qrcode.ecl = ecl;
+    return 1;
+}
+
+JCQRCodeContext* jc_qrencode_create_context()
+{
+    JCQRCodeInternal* qr = (JCQRCodeInternal*)malloc( sizeof(JCQRCodeInternal) );
+    if( !qr )
+        return 0;
+    qr->segments = 0;
+    qr->num_segments = 0;
+    qr->max_segments = 0;
+    qr->charmodes = 0;
+    qr->charmodes_size = 0;
+    qr->rs_generators_built = 0;
+    qr->mask_planes_built = 0;
+    qr->template_version = 0;
+    qr->last_version = 0;
+    return qr;
+}
+
+// Frees the memory that isn't part of the context itself
+static void _jc_qre_free_buffers(JCQRCodeInternal* qr)
+{
+    free(qr->segments);
+    free(qr->charmodes);
+    qr->segments = 0;
+    qr->max_segments = 0;
+    qr->charmodes = 0;
+    qr->charmodes_size = 0;
+}
+
+void jc_qrencode_destroy_context(JCQRCodeContext* ctx)
+{
+    _jc_qre_free_buffers(ctx);
+    free(ctx);
+}
+
+void jc_qrencode_init_options(JCQRCodeOptions* options)
+{
+    options->min_version = JC_QRE_MIN_VERSION;
+    options->max_version = JC_QRE_MAX_VERSION;
+    options->ecl = JC_QRE_ERROR_CORRECTION_LEVEL_LOW;
+    options->mask = JC_QRE_MASK_AUTO;
+    options->kanji = 0;
+}
+
+void jc_qrencode_get_kanji_unicode(uint16_t* unicode)
+{
+    memset(unicode, 0, sizeof(uint16_t) * JC_QRE_NUM_KANJI_VALUES);
+#if !defined(JC_QRE_NO_KANJI)
+    for( uint32_t i = 0; i < sizeof(JC_QRE_KANJI_TABLE) / sizeof(JC_QRE_KANJI_TABLE[0]); ++i )
+    {
+        unicode[JC_QRE_KANJI_TABLE[i] & 0x1FFF] = (uint16_t)(JC_QRE_KANJI_TABLE[i] >> 13);
     }
+#endif
+}
 
-        // Pick the smallest version that fits the data
-    uint32_t version = 0;
-    uint32_t numbits = 0;
-    for( uint32_t i = JC_QRE_MIN_VERSION; i <= JC_QRE_MAX_VERSION; ++i )
+// Splits the input into segments, and selects the version and error correction level
+static uint32_t _jc_qre_plan(JCQRCodeInternal* qr, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options)
+{
+    if( options->min_version < JC_QRE_MIN_VERSION || options->max_version > JC_QRE_MAX_VERSION || options->min_version > options->max_version ||
+        options->ecl > JC_QRE_ERROR_CORRECTION_LEVEL_HIGH || options->mask > JC_QRE_MASK_AUTO )
+        return 0;
+
+    _jc_qre_reset(qr);
+    qr->mask = options->mask;
+
+    // The best segmentation depends on the character count sizes, so try each range of versions
+    for( uint32_t i = 0; i < 3; ++i )
     {
-        uint32_t _numbits = _jc_qre_get_total_bits(qr, i);
-        uint32_t capacity_bits = JC_QRE_DATA_CODEWORD_COUNT[ JC_QRE_INDEX(JC_QRE_ERROR_CORRECTION_LEVEL_LOW, i) ] * 8;
-        if( _numbits < capacity_bits )
+        uint32_t first = JC_QRE_VERSION_CLASS_FIRST[i];
+        uint32_t last = JC_QRE_VERSION_CLASS_FIRST[i+1] - 1;
+        if( first < options->min_version )
+            first = options->min_version;
+        if( last > options->max_version )
+            last = options->max_version;
+        if( first > last )
+            continue;
+
+        if( _jc_qre_split_segments(qr, input, inputlength, first, options->kanji) == 0xFFFFFFFF )
         {
-            version = i;
-            numbits = _numbits;
-            break;
+            // todo: error codes
+            return 0;
         }
+
+        if( _jc_qre_select_version(qr, first, last, options->ecl) )
+            return 1;
     }
 
     // The data was too large
-    if( !version )
-    {
-        free(qr);
+    return 0;
+}
+
+JCQRCode* jc_qrencode_options_with_context(JCQRCodeContext* qr, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options)
+{
+    if( !_jc_qre_plan(qr, input, inputlength, options) )
         return 0;
+    return _jc_qrencode_internal(qr);
+}
+
+// Draws the code word at position 'index' in the interleaved code words, with the mask of the last code
+static void _jc_qre_redraw_codeword(JCQRCodeInternal* qr, uint32_t index, uint8_t value)
+{
+    uint32_t size = qr->qrcode.size;
+    const uint16_t* placements = &qr->placements[index * 8];
+    for( uint32_t i = 0; i < 8; ++i )
+    {
+        uint32_t x = placements[i] & 0xFF;
+        uint32_t y = placements[i] >> 8;
+        uint32_t black = ((value >> (7 - i)) & 1) ^ _jc_qre_is_masked(x, y, qr->last_mask);
+        _jc_qre_draw_module(qr, x, y, (uint8_t)black);
+        qr->image[y * size + x] = black ? 0 : 255;
     }
+}
 
-    qr->qrcode.version = version;
-    qr->qrcode.ecl = JC_QRE_ERROR_CORRECTION_LEVEL_LOW;
+// Updates the interleaved code word, and redraws it if it changed. Returns 1 if it changed
+static uint32_t _jc_qre_update_codeword(JCQRCodeInternal* qr, uint32_t index, uint8_t value)
+{
+    if( qr->interleaved[index] == value )
+        return 0;
+    qr->interleaved[index] = value;
+    _jc_qre_redraw_codeword(qr, index, value);
+    return 1;
+}
 
-    // Pick the highest error correction that fits within the same version
-    for( uint32_t i = JC_QRE_ERROR_CORRECTION_LEVEL_MEDIUM; i <= JC_QRE_ERROR_CORRECTION_LEVEL_HIGH; ++i )
+// Updates the last code with the new data code words, only recalculating the error correction of the blocks that changed
+static void _jc_qre_update_last_code(JCQRCodeInternal* qr)
+{
+    uint32_t index = JC_QRE_INDEX(qr->qrcode.ecl, qr->qrcode.version);
+    uint32_t block_count_group1 = JC_QRE_BLOCK_COUNT_GROUP1[index];
+    uint32_t num_blocks = block_count_group1 + JC_QRE_BLOCK_COUNT_GROUP2[index];
+    uint32_t num_data_cw_block1 = JC_QRE_CODEWORDS_PER_BLOCK_GROUP1[index];
+    uint32_t num_data_cw_block2 = JC_QRE_CODEWORDS_PER_BLOCK_GROUP2[index];
+    uint32_t num_ec_codewords_per_block = JC_QRE_ERROR_CORRECTION_CODEWORD_COUNT[index];
+    const uint8_t* coefficients = _jc_qre_rs_get_generator(qr, num_ec_codewords_per_block);
+
+    // The interleaved data code words are followed by the interleaved error correction code words
+    uint32_t num_data_codewords = num_data_cw_block1 * block_count_group1 + num_data_cw_block2 * (num_blocks - block_count_group1);
+
+    uint32_t data_offset = 0;
+    for( uint32_t i = 0; i < num_blocks; ++i )
     {
-        uint32_t capacity_bits = JC_QRE_DATA_CODEWORD_COUNT[ JC_QRE_INDEX(i, version) ] * 8;
-        if( numbits < capacity_bits )
+        uint32_t group1 = i < block_count_group1;
+        uint32_t data_cw_count = group1 ? num_data_cw_block1 : num_data_cw_block2;
+        const uint8_t* data = &qr->databuffer[data_offset];
+        data_offset += data_cw_count;
+
+        // The blocks in group 2 have one more code word, which is placed after the code words all blocks have
+        uint32_t changed = 0;
+        for( uint32_t cw = 0; cw < data_cw_count; ++cw )
+        {
+            uint32_t position = cw < num_data_cw_block1 ? cw * num_blocks + i : num_data_cw_block1 * num_blocks + (i - block_count_group1);
+            changed |= _jc_qre_update_codeword(qr, position, data[cw]);
+        }
+        if( !changed )
+            continue;
+
+        uint8_t* ec = &qr->errorcorrection[i * num_ec_codewords_per_block];
+        _jc_qre_rs_encode(num_ec_codewords_per_block, coefficients, data_cw_count, data, ec);
+        for( uint32_t cw = 0; cw < num_ec_codewords_per_block; ++cw )
         {
-            qr->qrcode.ecl = i;
+            _jc_qre_update_codeword(qr, num_data_codewords + cw * num_blocks + i, ec[cw]);
         }
     }
+}
+
+JCQRCode* jc_qrencode_update(JCQRCodeContext* qr, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options)
+{
+    uint32_t version = qr->last_version;
+    if( version && options->min_version <= version && version <= options->max_version && options->ecl <= qr->last_ecl &&
+        (options->mask == JC_QRE_MASK_AUTO || options->mask == qr->last_mask) )
+    {
+        _jc_qre_reset(qr);
+        if( _jc_qre_split_segments(qr, input, inputlength, version, options->kanji) != 0xFFFFFFFF && _jc_qre_check_version(qr, version, qr->last_ecl) )
+        {
+            // The modules and the placements of the last code are still valid
+            qr->qrcode.data = qr->image;
+            qr->qrcode.size = (version-1)*4 + 21;
+            qr->qrcode.stride = qr->qrcode.size;
+
+            _jc_qre_write_data(qr);
+            _jc_qre_update_last_code(qr);
+            return (JCQRCode*)&qr->qrcode;
+        }
+    }
+    return jc_qrencode_options_with_context(qr, input, inputlength, options);
+}
 
-    _jc_qrencode_internal(qr);
+JCQRCode* jc_qrencode_plan(JCQRCodeContext* qr, const uint8_t* input, uint32_t inputlength, const JCQRCodeOptions* options)
+{
+    if( !_jc_qre_plan(qr, input, inputlength, options) )
+        return 0;
+    qr->qrcode.size = (qr->qrcode.version-1)*4 + 21;
     return (JCQRCode*)&qr->qrcode;
 }
 
-JCQRCode* jc_qrencode_version(const uint8_t* input, uint32_t inputlength, uint32_t version, uint32_t ecl)
+JCQRCode* jc_qrencode_with_context(JCQRCodeContext* qr, const uint8_t* input, uint32_t inputlength)
 {
-    JCQRCodeInternal* qr = (JCQRCodeInternal*)malloc( sizeof(JCQRCodeInternal) );
-    memset(qr, 0, sizeof(JCQRCodeInternal) );
+    JCQRCodeOptions options;
+    jc_qrencode_init_options(&options);
+    return jc_qrencode_options_with_context(qr, input, inputlength, &options);
+}
+
+JCQRCode* jc_qrencode_version_with_context(JCQRCodeContext* qr, const uint8_t* input, uint32_t inputlength, uint32_t version, uint32_t ecl)
+{
+    if( version < JC_QRE_MIN_VERSION || version > JC_QRE_MAX_VERSION || ecl > JC_QRE_ERROR_CORRECTION_LEVEL_HIGH )
+        return 0;
 
-    uint32_t result = _jc_qre_add_segment(qr, input, inputlength);
+    _jc_qre_reset(qr);
 
-    if( result == 0xFFFFFFFF )
+    if( _jc_qre_split_segments(qr, input, inputlength, version, 0) == 0xFFFFFFFF )
     {
         // todo: error codes
-        free(qr);
         return 0;
     }
 
-    qr->qrcode.version = version;
-    qr->qrcode.ecl = ecl;
+    if( !_jc_qre_check_version(qr, version, ecl) )
+        return 0;
 
-    uint32_t numbits = _jc_qre_get_total_bits(qr, version);
-    uint32_t capacity_bits = JC_QRE_DATA_CODEWORD_COUNT[ JC_QRE_INDEX(ecl, version) ] * 8;
-    if( numbits > capacity_bits )
+    return _jc_qrencode_internal(qr);
+}
+
+JCQRCode* jc_qrencode_segments_with_context(JCQRCodeContext* qr, const JCQRCodeSegmentInput* segments, uint32_t num_segments, uint32_t version, uint32_t ecl)
+{
+    if( version > JC_QRE_MAX_VERSION || ecl > JC_QRE_ERROR_CORRECTION_LEVEL_HIGH )
+        return 0;
+
+    _jc_qre_reset(qr);
+
+    for( uint32_t i = 0; i < num_segments; ++i )
+    {
+        const JCQRCodeSegmentInput* segment = &segments[i];
+        if( segment->mode > JC_QRE_MODE_KANJI || !_jc_qre_is_valid_segment((uint8_t)segment->mode, segment->data, segment->length) )
+            return 0;
+        if( _jc_qre_add_segment(qr, (uint8_t)segment->mode, segment->data, segment->length) == 0xFFFFFFFF )
+            return 0;
+    }
+
+    if( version == 0 )
+    {
+        if( !_jc_qre_select_version(qr, JC_QRE_MIN_VERSION, JC_QRE_MAX_VERSION, JC_QRE_ERROR_CORRECTION_LEVEL_LOW) )
+            return 0;
+    }
+    else if( !_jc_qre_check_version(qr, version, ecl) )
     {
-        free(qr);
         return 0;
     }
 
-    _jc_qrencode_internal(qr);
-    return (JCQRCode*)&qr->qrcode;
+    return _jc_qrencode_internal(qr);
+}
+
+// The context starts with the qrcode, so the returned pointer can be passed to free()
+JCQRCode* jc_qrencode(const uint8_t* input, uint32_t inputlength)
+{
+    JCQRCodeContext* ctx = jc_qrencode_create_context();
+    if( !ctx )
+        return 0;
+
+    JCQRCode* qr = jc_qrencode_with_context(ctx, input, inputlength);
+    if( !qr )
+    {
+        jc_qrencode_destroy_context(ctx);
+        return 0;
+    }
+    _jc_qre_free_buffers(ctx);
+    return qr;
+}
+
+JCQRCode* jc_qrencode_version(const uint8_t* input, uint32_t inputlength, uint32_t version, uint32_t ecl)
+{
+    JCQRCodeContext* ctx = jc_qrencode_create_context();
+    if( !ctx )
+        return 0;
+
+    JCQRCode* qr = jc_qrencode_version_with_context(ctx, input, inputlength, version, ecl);
+    if( !qr )
+    {
+        jc_qrencode_destroy_context(ctx);
+        return 0;
+    }
+    _jc_qre_free_buffers(ctx);
+    return qr;
 }
 
 #undef JC_QRE_INDEX
+#undef JC_QRE_MAX_EC_CODEWORDS
+#undef JC_QRE_MAX_SIZE
+#undef JC_QRE_LINE_OFFSET
+#undef JC_QRE_LINE_WORDS
+#undef JC_QRE_MASK_PERIOD
+#undef JC_QRE_NUM_AUTO_MODES
+#undef JC_QRE_MAX_BLOCK_CODEWORDS
+#undef JC_QRE_MAX_DATA_MODULES
 
 #endif // JC_QRENCODE_IMPLEMENTATION
 #endif // JC_QRENCODE_H
\ No newline at end of file
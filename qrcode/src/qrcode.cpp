@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
 
 #define EXTENSION_NAME QRCode
 #define LIB_NAME "QRCode"
@@ -17,32 +18,152 @@
 // GENERATE
 // https://github.com/nayuki/QR-Code-generator
 
+// The max number of threads used by generate_batch (including the calling thread)
+static const uint32_t QRCODE_MAX_WORKERS = 16;
+static const uint32_t QRCODE_DEFAULT_WORKERS = 4;
+
+struct CacheEntry;
+
+struct GenerateCache
+{
+    CacheEntry* first;          // The most recently used entry
+    CacheEntry* last;           // The least recently used entry
+    CacheEntry** buckets;       // The entries chained by hash, at (hash & (num_buckets-1))
+    uint32_t    num_buckets;    // A power of two, grown to at least the number of entries
+    uint32_t    max_memory;     // The memory budget, in bytes (0 = disabled)
+    uint32_t    memory;         // The memory used by the entries, in bytes
+    uint32_t    count;
+    uint32_t    hits;
+    uint32_t    misses;
+    uint32_t    evictions;
+    bool        images;         // Also cache the rendered images
+};
+
 struct QRCodeContext
 {
+    struct quirc* qr;   // The scanner, kept between scans along with its decoding scratch space
     int width;
     int height;
+    uint16_t* kanji_unicode;    // The unicode character of each Kanji mode value, for converting scanned Kanji to UTF-8
+    JCQRCodeContext* encoder;   // The encoder, reused between generated codes
+    JCQRCodeContext* updater;   // The encoder for incremental codes, which keeps the last code
+    JCQRCodeContext* workers[QRCODE_MAX_WORKERS]; // One encoder per thread in generate_batch
+    GenerateCache cache;        // Generated codes, see qrcode.set_cache()
 };
 
 QRCodeContext g_QRContext;
 
+static const dmhash_t QRCODE_STREAM_DATA = dmHashString64("data");
+static const dmhash_t QRCODE_STREAM_POSITION = dmHashString64("position");
+
+// Creates a buffer with a single "data" stream of UINT8 * 1
+static dmBuffer::HBuffer CreateByteBuffer(uint32_t size)
+{
+    dmBuffer::StreamDeclaration streams_decl[] = {
+        {QRCODE_STREAM_DATA, dmBuffer::VALUE_TYPE_UINT8, 1}
+    };
+
+    dmBuffer::HBuffer buffer = 0;
+    dmBuffer::Result result = dmBuffer::Create(size, streams_decl, 1, &buffer);
+    if (result != dmBuffer::RESULT_OK )
+    {
+        return 0;
+    }
+    return buffer;
+}
+
+// Gets the "data" stream of a buffer, which must be tightly packed UINT8 * 1
+static bool GetByteStream(dmBuffer::HBuffer buffer, uint8_t** out, uint32_t* outsize)
+{
+    dmBuffer::ValueType type;
+    uint32_t components = 0;
+    if( dmBuffer::GetStreamType(buffer, QRCODE_STREAM_DATA, &type, &components) != dmBuffer::RESULT_OK )
+        return false;
+    if( type != dmBuffer::VALUE_TYPE_UINT8 || components != 1 )
+        return false;
+
+    uint32_t count = 0;
+    uint32_t stride = 0;
+    if( dmBuffer::GetStream(buffer, QRCODE_STREAM_DATA, (void**)out, &count, &components, &stride) != dmBuffer::RESULT_OK )
+        return false;
+    if( stride != 1 )
+        return false;
+
+    *outsize = count;
+    return true;
+}
+
+// Converts the Kanji segments of scanned codes to UTF-8, instead of Shift JIS
+static int DecodeKanji(int value, uint8_t* utf8)
+{
+    uint32_t codepoint = g_QRContext.kanji_unicode ? g_QRContext.kanji_unicode[value & 0x1FFF] : 0;
+    if( codepoint == 0 )
+        return 0;
+    if( codepoint < 0x80 )
+    {
+        utf8[0] = (uint8_t)codepoint;
+        return 1;
+    }
+    if( codepoint < 0x800 )
+    {
+        utf8[0] = (uint8_t)(0xC0 | (codepoint >> 6));
+        utf8[1] = (uint8_t)(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    utf8[0] = (uint8_t)(0xE0 | (codepoint >> 12));
+    utf8[1] = (uint8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+    utf8[2] = (uint8_t)(0x80 | (codepoint & 0x3F));
+    return 3;
+}
+
 static int Scan(lua_State* L)
 {
-    DM_LUA_STACK_CHECK(L, 1);
+    DM_LUA_STACK_CHECK(L, 2);
 
     dmScript::LuaHBuffer* buffer = dmScript::CheckBuffer(L, 1);
     int width = luaL_checkint(L, 2);
     int height = luaL_checkint(L, 3);
     int flip_x = luaL_checkint(L, 4);
 
-    struct quirc* qr;
+    // Optionally decode the payload straight into a buffer, instead of a string
+    dmBuffer::HBuffer outbuffer = 0;
+    bool create_buffer = false;
+    if( !lua_isnoneornil(L, 5) )
+    {
+        if( dmScript::IsBuffer(L, 5) )
+            outbuffer = dmScript::CheckBuffer(L, 5)->m_Buffer;
+        else if( lua_isboolean(L, 5) )
+            create_buffer = lua_toboolean(L, 5) != 0;
+        else
+            return DM_LUA_ERROR("qrcode.scan: Argument 'out' must be a buffer or a boolean");
+    }
+
+    if (!g_QRContext.qr) {
+        g_QRContext.qr = quirc_new();
+        if (!g_QRContext.qr) {
+            return DM_LUA_ERROR("qrcode.scan: Failed to allocate memory");
+        }
+        g_QRContext.width = 0;
+        g_QRContext.height = 0;
+    }
 
-    qr = quirc_new();
-    if (!qr) {
-        return luaL_error(L, "qrcode.scan: Failed to allocate memory");
+    if (!g_QRContext.kanji_unicode) {
+        g_QRContext.kanji_unicode = (uint16_t*)malloc(sizeof(uint16_t) * JC_QRE_NUM_KANJI_VALUES);
+        if (g_QRContext.kanji_unicode) {
+            jc_qrencode_get_kanji_unicode(g_QRContext.kanji_unicode);
+            quirc_set_kanji_decoder(DecodeKanji);
+        }
     }
 
-    if (quirc_resize(qr, width, height) < 0) {
-        return luaL_error(L, "qrcode.scan: Failed to allocate video memory");
+    struct quirc* qr = g_QRContext.qr;
+    if (width != g_QRContext.width || height != g_QRContext.height) {
+        if (quirc_resize(qr, width, height) < 0) {
+            g_QRContext.width = 0;
+            g_QRContext.height = 0;
+            return DM_LUA_ERROR("qrcode.scan: Failed to allocate video memory");
+        }
+        g_QRContext.width = width;
+        g_QRContext.height = height;
     }
 
     uint8_t* image = quirc_begin(qr, &width, &height);
@@ -78,134 +199,1654 @@ static int Scan(lua_State* L)
 
     quirc_end(qr);
 
+    int num_pushed = 0;
     int num_codes = quirc_count(qr);
     for( int i = 0; i < num_codes; i++)
     {
-        struct quirc_code code;
-        struct quirc_data data;
-
-        quirc_extract(qr, i, &code);
+        // The code and decoder state live in the scanner, not on the stack
+        const struct quirc_code* code = quirc_extract_scratch(qr, i);
+        if( !code )
+            break;
 
-        quirc_decode_error_t err = quirc_decode(&code, &data);
-        if (err)
+        const struct quirc_data* data = 0;
+        if( create_buffer || outbuffer )
         {
-            num_codes = 0;
+            if( create_buffer )
+            {
+                outbuffer = CreateByteBuffer((uint32_t)quirc_payload_capacity(code));
+                if( !outbuffer )
+                    break;
+            }
+
+            uint8_t* payload = 0;
+            uint32_t payloadsize = 0;
+            quirc_decode_error_t err = QUIRC_ERROR_DATA_OVERFLOW;
+            if( GetByteStream(outbuffer, &payload, &payloadsize) )
+                err = quirc_decode_scratch(qr, &data, payload, (int)payloadsize);
+
+            if (err)
+            {
+                if( create_buffer )
+                    dmBuffer::Destroy(outbuffer);
+                break;
+            }
+
+            if( create_buffer )
+            {
+                // Transfer ownership to Lua
+                dmScript::LuaHBuffer luabuffer(outbuffer, dmScript::OWNER_LUA);
+                dmScript::PushBuffer(L, luabuffer);
+            }
+            else
+            {
+                lua_pushvalue(L, 5);
+            }
         }
         else
         {
-            lua_pushstring(L, (const char*)data.payload);
+            quirc_decode_error_t err = quirc_decode_scratch(qr, &data, 0, 0);
+            if (err)
+                break;
+            lua_pushlstring(L, (const char*)data->payload, data->payload_len);
         }
+        lua_pushinteger(L, data->payload_len);
+        num_pushed = 2;
         break;
     }
 
-    quirc_destroy(qr);
-
-    if( num_codes == 0 )
+    if( num_pushed == 0 )
     {
         lua_pushnil(L);
+        lua_pushnil(L);
     }
 
-    return 1;
+    return 2;
 }
 
-static dmBuffer::HBuffer GenerateImage(JCQRCode* qr, uint32_t* outsize)
+static const uint32_t QRCODE_IMAGE_BORDER = 2;
+static const uint32_t QRCODE_IMAGE_SCALE = 8;
+static const uint32_t QRCODE_IMAGE_MAX_BORDER = 64;
+static const uint32_t QRCODE_IMAGE_MAX_SCALE = 32;
+
+// The image formats. The compressed formats are made of 4x4 texel blocks
+static const uint32_t QRCODE_FORMAT_LUMINANCE = 0;  // One byte per texel
+static const uint32_t QRCODE_FORMAT_ETC1 = 1;       // ETC1 RGB, 8 bytes per block
+static const uint32_t QRCODE_FORMAT_ETC2 = 2;       // ETC2 RGBA (EAC alpha), 16 bytes per block
+static const uint32_t QRCODE_FORMAT_BC1 = 3;        // BC1 RGB, 8 bytes per block
+static const uint32_t QRCODE_FORMAT_ASTC = 4;       // ASTC 4x4 LDR, 16 bytes per block
+static const uint32_t QRCODE_FORMAT_SDF = 5;        // One byte per texel, the signed distance to the edges of the dark modules
+
+static const char* QRCODE_FORMAT_NAMES[] = { "luminance", "etc1", "etc2", "bc1", "astc", "sdf" };
+
+struct GenerateOptions
 {
-    int32_t size = qr->size;
-    int32_t border = 2;
-    int32_t scale = 8;
-    int32_t newsize = scale*(size + 2 * border);
+    JCQRCodeOptions encoder;
+    uint32_t        border; // The quiet zone around the code, in modules
+    uint32_t        scale;  // The size of a module, in texels
+    uint32_t        format; // One of the QRCODE_FORMAT_* values
+    bool            pow2;   // Pad the image to a power of two size
+    bool            incremental; // Update the last incremental code, instead of encoding a new one
+};
 
-    dmBuffer::StreamDeclaration streams_decl[] = {
-        {dmHashString64("data"), dmBuffer::VALUE_TYPE_UINT8, 1}
-    };
+// Reads the options table at the index (if any) into 'options'
+// Returns an error message if an option was invalid
+static const char* GetGenerateOptions(lua_State* L, int index, GenerateOptions* options)
+{
+    memset(options, 0, sizeof(*options));
+    jc_qrencode_init_options(&options->encoder);
+    options->border = QRCODE_IMAGE_BORDER;
+    options->scale = QRCODE_IMAGE_SCALE;
+    options->pow2 = false;
 
-    dmBuffer::HBuffer buffer = 0;
-    dmBuffer::Result result = dmBuffer::Create(newsize * newsize, streams_decl, 1, &buffer);
-    if (result != dmBuffer::RESULT_OK )
-    {
+    if( !lua_istable(L, index) )
         return 0;
+
+    const char* error = 0;
+
+    lua_getfield(L, index, "ecl");
+    if( !lua_isnil(L, -1) )
+    {
+        const char* ecl = lua_tostring(L, -1);
+        if( ecl && strcmp(ecl, "L") == 0 )      options->encoder.ecl = JC_QRE_ERROR_CORRECTION_LEVEL_LOW;
+        else if( ecl && strcmp(ecl, "M") == 0 ) options->encoder.ecl = JC_QRE_ERROR_CORRECTION_LEVEL_MEDIUM;
+        else if( ecl && strcmp(ecl, "Q") == 0 ) options->encoder.ecl = JC_QRE_ERROR_CORRECTION_LEVEL_QUARTILE;
+        else if( ecl && strcmp(ecl, "H") == 0 ) options->encoder.ecl = JC_QRE_ERROR_CORRECTION_LEVEL_HIGH;
+        else error = "'ecl' must be one of \"L\", \"M\", \"Q\" or \"H\"";
     }
+    lua_pop(L, 1);
 
-    uint8_t* data;
-    uint32_t datasize;
-    dmBuffer::GetBytes(buffer, (void**)&data, &datasize);
+    lua_getfield(L, index, "min_version");
+    if( !lua_isnil(L, -1) )
+        options->encoder.min_version = (uint32_t)lua_tointeger(L, -1);
+    lua_pop(L, 1);
+
+    lua_getfield(L, index, "max_version");
+    if( !lua_isnil(L, -1) )
+        options->encoder.max_version = (uint32_t)lua_tointeger(L, -1);
+    lua_pop(L, 1);
+
+    if( options->encoder.min_version < JC_QRE_MIN_VERSION || options->encoder.max_version > JC_QRE_MAX_VERSION || options->encoder.min_version > options->encoder.max_version )
+        error = "'min_version' and 'max_version' must be in the range [1,40], with min_version <= max_version";
+
+    lua_getfield(L, index, "mask");
+    if( !lua_isnil(L, -1) )
+    {
+        lua_Integer mask = lua_tointeger(L, -1);
+        if( mask < 0 || mask > 7 )
+            error = "'mask' must be in the range [0,7]";
+        else
+            options->encoder.mask = (uint32_t)mask;
+    }
+    lua_pop(L, 1);
+
+    lua_getfield(L, index, "border");
+    if( !lua_isnil(L, -1) )
+    {
+        lua_Integer border = lua_tointeger(L, -1);
+        if( border < 0 || border > (lua_Integer)QRCODE_IMAGE_MAX_BORDER )
+            error = "'border' must be in the range [0,64]";
+        else
+            options->border = (uint32_t)border;
+    }
+    lua_pop(L, 1);
+
+    lua_getfield(L, index, "scale");
+    if( !lua_isnil(L, -1) )
+    {
+        lua_Integer scale = lua_tointeger(L, -1);
+        if( scale < 1 || scale > (lua_Integer)QRCODE_IMAGE_MAX_SCALE )
+            error = "'scale' must be in the range [1,32]";
+        else
+            options->scale = (uint32_t)scale;
+    }
+    lua_pop(L, 1);
 
-    memset(data, 255, newsize*newsize);
+    lua_getfield(L, index, "pow2");
+    options->pow2 = lua_toboolean(L, -1) != 0;
+    lua_pop(L, 1);
 
-    for( int y = 0; y < size*scale; ++y )
+    lua_getfield(L, index, "format");
+    if( !lua_isnil(L, -1) )
     {
-        for( int x = 0; x < size*scale; ++x )
+        const char* format = lua_tostring(L, -1);
+        uint32_t num_formats = sizeof(QRCODE_FORMAT_NAMES)/sizeof(QRCODE_FORMAT_NAMES[0]);
+        uint32_t i = 0;
+        for( ; i < num_formats; ++i )
         {
-            int flip_y = size*scale - y - 1; // flip it so we can easily pass it as a texture later on
-            uint8_t module = qr->data[(flip_y/scale)*256 + (x/scale)];
-            data[(y + scale*border) * newsize + x + scale*border] = module;
+            if( format && strcmp(format, QRCODE_FORMAT_NAMES[i]) == 0 )
+                break;
         }
+        if( i == num_formats )
+            error = "'format' must be one of \"luminance\", \"etc1\", \"etc2\", \"bc1\", \"astc\" or \"sdf\"";
+        else
+            options->format = i;
     }
+    lua_pop(L, 1);
 
-    if (outsize)
-        *outsize = newsize;
-    return buffer;
+    lua_getfield(L, index, "kanji");
+    options->encoder.kanji = lua_toboolean(L, -1) != 0;
+    lua_pop(L, 1);
+
+    lua_getfield(L, index, "incremental");
+    options->incremental = lua_toboolean(L, -1) != 0;
+    lua_pop(L, 1);
+
+    return error;
 }
 
-static int Generate(lua_State* L)
+// The size of the qr code image, including the border
+static uint32_t GetCodeImageSize(JCQRCode* qr, const GenerateOptions* options)
 {
-    DM_LUA_STACK_CHECK(L, 2);
+    return options->scale*(qr->size + 2 * options->border);
+}
 
-    const char* text = luaL_checkstring(L, 1);
+static bool IsBlockFormat(uint32_t format)
+{
+    return format != QRCODE_FORMAT_LUMINANCE && format != QRCODE_FORMAT_SDF;
+}
 
-    JCQRCode* qr = jc_qrencode((const uint8_t*)text, (uint32_t)strlen(text));
-    if( !qr )
+// The size of the whole image, including any padding
+static uint32_t GetImageSize(JCQRCode* qr, const GenerateOptions* options)
+{
+    uint32_t size = GetCodeImageSize(qr, options);
+    if( options->pow2 )
     {
-        return DM_LUA_ERROR("Failed to encode text: '%s'\n", text);
+        uint32_t pow2 = 1;
+        while( pow2 < size )
+            pow2 <<= 1;
+        size = pow2;
     }
+    // The compressed formats are padded to whole blocks
+    if( IsBlockFormat(options->format) )
+        size = (size + 3) & ~3u;
+    return size;
+}
+
+static uint32_t GetBlockBytes(uint32_t format)
+{
+    return (format == QRCODE_FORMAT_ETC1 || format == QRCODE_FORMAT_BC1) ? 8 : 16;
+}
 
-    uint32_t outsize = 0;
-    dmBuffer::HBuffer buffer = GenerateImage(qr, &outsize);
+// The size of the whole image, in bytes
+static uint32_t GetImageBytes(JCQRCode* qr, const GenerateOptions* options)
+{
+    uint32_t size = GetImageSize(qr, options);
+    if( !IsBlockFormat(options->format) )
+        return size * size;
+    uint32_t num_blocks = size / 4;
+    return num_blocks * num_blocks * GetBlockBytes(options->format);
+}
 
-    free(qr); // free the qr code
+// The blocks are written from a mask of the black texels in the block, where bit (y*4 + x) is the texel at (x, y)
 
-    // Transfer ownership to Lua
-    dmScript::LuaHBuffer luabuffer(buffer, dmScript::OWNER_LUA);
-    dmScript::PushBuffer(L, luabuffer);
-    lua_pushinteger(L, outsize);
-    return 2;
+// Individual mode, where both halves use the gray base color 0x88 and the modifier table 7 (+-47, +-183).
+// The large modifiers clamp to white and black, so the pixel index is 01 for white and 11 for black
+static void WriteBlockETC1(uint32_t mask, uint8_t* out)
+{
+    out[0] = 0x88;
+    out[1] = 0x88;
+    out[2] = 0x88;
+    out[3] = (7 << 5) | (7 << 2); // the tables, diff bit = 0, flip bit = 0
+
+    // The pixel indices are stored column by column: the most significant bits first, then the least significant bits
+    uint32_t msb = 0;
+    for( uint32_t y = 0; y < 4; ++y )
+    {
+        for( uint32_t x = 0; x < 4; ++x )
+        {
+            if( mask & (1u << (y*4 + x)) )
+                msb |= 1u << (x*4 + y);
+        }
+    }
+    out[4] = (uint8_t)(msb >> 8);
+    out[5] = (uint8_t)(msb & 0xFF);
+    out[6] = 0xFF;
+    out[7] = 0xFF;
 }
 
-static const luaL_reg Module_methods[] =
+// An opaque EAC alpha block (base 255, multiplier 1, table 0, all indices +2), followed by an ETC1 compatible color block
+static void WriteBlockETC2(uint32_t mask, uint8_t* out)
 {
-    {"scan", Scan},
-    {"generate", Generate},
-    {0, 0}
+    static const uint8_t alpha[8] = { 0xFF, 0x10, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24 };
+    memcpy(out, alpha, sizeof(alpha));
+    WriteBlockETC1(mask, out + 8);
+}
+
+// color0 (white) > color1 (black) selects the four color mode, where index 0 is color0 and index 1 is color1
+static void WriteBlockBC1(uint32_t mask, uint8_t* out)
+{
+    out[0] = 0xFF;
+    out[1] = 0xFF;
+    out[2] = 0x00;
+    out[3] = 0x00;
+
+    // Two bits per texel, row by row
+    uint32_t indices = 0;
+    for( uint32_t i = 0; i < 16; ++i )
+    {
+        if( mask & (1u << i) )
+            indices |= 1u << (i*2);
+    }
+    out[4] = (uint8_t)(indices & 0xFF);
+    out[5] = (uint8_t)((indices >> 8) & 0xFF);
+    out[6] = (uint8_t)((indices >> 16) & 0xFF);
+    out[7] = (uint8_t)(indices >> 24);
+}
+
+// A single partition with a 4x4 grid of 1 bit weights (block mode 0x41), and the luminance endpoint mode (CEM 0)
+// with the endpoints 255 (white) and 0 (black), stored as 8 bit values from bit 17.
+// The weights are stored bit reversed from the top of the block, so the weight of texel i is bit (127 - i)
+static void WriteBlockASTC(uint32_t mask, uint8_t* out)
+{
+    memset(out, 0, 16);
+    out[0] = 0x41;
+    out[2] = 0xFE; // bits 17-23 of the first endpoint
+    out[3] = 0x01; // bit 24 of the first endpoint
+
+    for( uint32_t i = 0; i < 16; ++i )
+    {
+        if( mask & (1u << i) )
+            out[15 - i/8] |= (uint8_t)(0x80 >> (i & 7));
+    }
+}
+
+// Renders the qr code into GetImageBytes() bytes of 4x4 blocks, with the same layout as RenderImage
+static void RenderBlocks(JCQRCode* qr, const GenerateOptions* options, uint8_t* data)
+{
+    uint32_t size = qr->size;
+    uint32_t scale = options->scale;
+    uint32_t newsize = GetImageSize(qr, options);
+    uint32_t start = scale*options->border;
+    uint32_t end = start + scale*size;
+    uint32_t num_blocks = newsize / 4;
+    uint32_t block_bytes = GetBlockBytes(options->format);
+
+    for( uint32_t by = 0; by < num_blocks; ++by )
+    {
+        // The modules of the four rows (flipped, as in RenderImage), or 0 for the rows outside of the code
+        const uint8_t* rows[4];
+        for( uint32_t i = 0; i < 4; ++i )
+        {
+            uint32_t y = by*4 + i;
+            rows[i] = (y >= start && y < end) ? qr->data + (size - (y - start)/scale - 1)*qr->stride : 0;
+        }
+
+        uint32_t module = 0;    // The module of the current texel column
+        uint32_t count = 0;     // The texels left of the current module
+        for( uint32_t bx = 0; bx < num_blocks; ++bx )
+        {
+            uint32_t mask = 0;
+            for( uint32_t x = 0; x < 4; ++x )
+            {
+                uint32_t texel = bx*4 + x;
+                if( texel < start || texel >= end )
+                    continue;
+                for( uint32_t i = 0; i < 4; ++i )
+                {
+                    if( rows[i] && rows[i][module] == 0 )
+                        mask |= 1u << (i*4 + x);
+                }
+                if( ++count == scale )
+                {
+                    count = 0;
+                    module++;
+                }
+            }
+
+            switch( options->format )
+            {
+            case QRCODE_FORMAT_ETC1:    WriteBlockETC1(mask, data); break;
+            case QRCODE_FORMAT_ETC2:    WriteBlockETC2(mask, data); break;
+            case QRCODE_FORMAT_BC1:     WriteBlockBC1(mask, data); break;
+            default:                    WriteBlockASTC(mask, data); break;
+            }
+            data += block_bytes;
+        }
+    }
+}
+
+// Is the module dark? The coordinates are in image space (flipped, as in RenderImage), and the modules outside of the code are light
+static bool IsDarkModule(JCQRCode* qr, int x, int y)
+{
+    int size = (int)qr->size;
+    if( x < 0 || y < 0 || x >= size || y >= size )
+        return false;
+    return qr->data[(size - y - 1)*qr->stride + x] == 0;
+}
+
+// Renders the signed distance from each texel center to the nearest edge between a dark and a light module.
+// The distance is in modules, clamped to [-1,1] (positive inside the dark modules), and stored as 127.5 + 127.5 * distance.
+// Since the distance is clamped to one module, only the neighbouring modules need to be checked, which makes it exact
+static void RenderDistanceField(JCQRCode* qr, const GenerateOptions* options, uint8_t* data)
+{
+    uint32_t scale = options->scale;
+    uint32_t newsize = GetImageSize(qr, options);
+    int border = (int)options->border;
+    float inv_scale = 1.0f / scale;
+
+    for( uint32_t ty = 0; ty < newsize; ++ty )
+    {
+        float py = (ty + 0.5f) * inv_scale - border; // The texel center, in modules
+        int my = (int)floorf(py);
+        uint8_t* row = data + ty*newsize;
+        for( uint32_t tx = 0; tx < newsize; ++tx )
+        {
+            float px = (tx + 0.5f) * inv_scale - border;
+            int mx = (int)floorf(px);
+            bool dark = IsDarkModule(qr, mx, my);
+
+            // The distance to the closest module of the other color
+            float min_distance2 = 1.0f;
+            for( int y = my - 1; y <= my + 1; ++y )
+            {
+                for( int x = mx - 1; x <= mx + 1; ++x )
+                {
+                    if( IsDarkModule(qr, x, y) == dark )
+                        continue;
+                    float dx = x > mx ? x - px : (x < mx ? px - (x + 1) : 0.0f);
+                    float dy = y > my ? y - py : (y < my ? py - (y + 1) : 0.0f);
+                    float distance2 = dx*dx + dy*dy;
+                    if( distance2 < min_distance2 )
+                        min_distance2 = distance2;
+                }
+            }
+            float distance = sqrtf(min_distance2);
+            if( !dark )
+                distance = -distance;
+            row[tx] = (uint8_t)(127.5f + 127.5f * distance + 0.5f);
+        }
+    }
+}
+
+// Renders the qr code into an image of GetImageBytes() bytes
+// When padded, the code is placed in the first rows and columns, and the padding is white
+static void RenderImage(JCQRCode* qr, const GenerateOptions* options, uint8_t* data)
+{
+    if( options->format == QRCODE_FORMAT_SDF )
+    {
+        RenderDistanceField(qr, options, data);
+        return;
+    }
+    if( IsBlockFormat(options->format) )
+    {
+        RenderBlocks(qr, options, data);
+        return;
+    }
+
+    uint32_t size = qr->size;
+    uint32_t scale = options->scale;
+    uint32_t newsize = GetImageSize(qr, options);
+    uint32_t start = scale*options->border;  // The first texel of the code, in x and y
+    uint32_t end = start + scale*size;
+
+    memset(data, 255, start*newsize);
+    memset(data + end*newsize, 255, (newsize - end)*newsize);
+
+    for( uint32_t y = 0; y < size; ++y )
+    {
+        // flip it so we can easily pass it as a texture later on
+        const uint8_t* modules = qr->data + (size - y - 1)*qr->stride;
+        uint8_t* row = data + (start + y*scale)*newsize;
+
+        memset(row, 255, start);
+        if( scale == 1 )
+        {
+            memcpy(row + start, modules, size);
+        }
+        else
+        {
+            uint8_t* out = row + start;
+            for( uint32_t x = 0; x < size; ++x )
+            {
+                uint8_t module = modules[x];
+                for( uint32_t i = 0; i < scale; ++i )
+                    *out++ = module;
+            }
+        }
+        memset(row + end, 255, newsize - end);
+
+        // Build each row once, and copy it to the rows of the same modules
+        for( uint32_t i = 1; i < scale; ++i )
+            memcpy(row + i*newsize, row, newsize);
+    }
+}
+
+static JCQRCodeContext* GetEncoder()
+{
+    if( !g_QRContext.encoder )
+        g_QRContext.encoder = jc_qrencode_create_context();
+    return g_QRContext.encoder;
+}
+
+// CACHE
+
+// The options a cached code depends on, see GetCacheKeyOptions()
+static const uint32_t QRCODE_CACHE_KEY_OPTIONS = 9;
+
+struct CacheEntry
+{
+    CacheEntry*     prev;       // The more recently used entry
+    CacheEntry*     next;       // The less recently used entry
+    CacheEntry*     chain;      // The next entry in the same bucket
+    uint64_t        hash;       // The hash of the text and the options
+    uint32_t        options[QRCODE_CACHE_KEY_OPTIONS];
+    JCQRCode        qr;         // The data points to the modules
+    uint32_t        length;     // The length of the text
+    uint32_t        image_size; // The size of the image, in bytes, or 0 if the image isn't cached
+    uint32_t        memory;     // The size of the entry, in bytes
+    // Followed by the text, the modules and the image
 };
 
-static void LuaInit(lua_State* L)
+static uint8_t* GetCacheText(CacheEntry* entry)
 {
-    int top = lua_gettop(L);
-    luaL_register(L, MODULE_NAME, Module_methods);
+    return (uint8_t*)(entry + 1);
+}
 
-#define SETCONSTANT(name) \
-        lua_pushnumber(L, (lua_Number) name); \
-        lua_setfield(L, -2, #name);\
+static uint8_t* GetCacheImage(CacheEntry* entry)
+{
+    return GetCacheText(entry) + entry->length + entry->qr.size * entry->qr.size;
+}
 
-#undef SETCONSTANT
+// FNV-1a
+static uint64_t CacheHash(uint64_t hash, const void* data, uint32_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    for( uint32_t i = 0; i < size; ++i )
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
 
-    lua_pop(L, 1);
-    assert(top == lua_gettop(L));
+// Gets the options that change the modules, and the options that change the image if the images are cached.
+// Codes that only differ in the other options share the cached modules
+static void GetCacheKeyOptions(const GenerateCache* cache, const GenerateOptions* options, uint32_t* key)
+{
+    memset(key, 0, sizeof(uint32_t) * QRCODE_CACHE_KEY_OPTIONS);
+    key[0] = options->encoder.min_version;
+    key[1] = options->encoder.max_version;
+    key[2] = options->encoder.ecl;
+    key[3] = options->encoder.mask;
+    key[4] = options->encoder.kanji;
+    if( cache->images )
+    {
+        key[5] = options->border;
+        key[6] = options->scale;
+        key[7] = options->format;
+        key[8] = options->pow2 ? 1 : 0;
+    }
 }
 
-dmExtension::Result AppInitializeQRCode(dmExtension::AppParams* params)
+static uint64_t CacheHashKey(const char* text, uint32_t length, const uint32_t* options)
 {
-    return dmExtension::RESULT_OK;
+    uint64_t hash = CacheHash(0xcbf29ce484222325ULL, text, length);
+    return CacheHash(hash, options, sizeof(uint32_t) * QRCODE_CACHE_KEY_OPTIONS);
 }
 
-dmExtension::Result InitializeQRCode(dmExtension::Params* params)
+static void CacheUnlink(GenerateCache* cache, CacheEntry* entry)
 {
-    LuaInit(params->m_L);
-    return dmExtension::RESULT_OK;
+    if( entry->prev )
+        entry->prev->next = entry->next;
+    else
+        cache->first = entry->next;
+    if( entry->next )
+        entry->next->prev = entry->prev;
+    else
+        cache->last = entry->prev;
 }
 
-dmExtension::Result AppFinalizeQRCode(dmExtension::AppParams* params)
+static void CacheLinkFirst(GenerateCache* cache, CacheEntry* entry)
+{
+    entry->prev = 0;
+    entry->next = cache->first;
+    if( cache->first )
+        cache->first->prev = entry;
+    else
+        cache->last = entry;
+    cache->first = entry;
+}
+
+static CacheEntry** CacheGetBucket(GenerateCache* cache, uint64_t hash)
+{
+    return &cache->buckets[hash & (cache->num_buckets - 1)];
+}
+
+// Resizes the hash table, and moves the entries to their new buckets. Returns false if the allocation failed
+static bool CacheRehash(GenerateCache* cache, uint32_t num_buckets)
+{
+    CacheEntry** buckets = (CacheEntry**)calloc(num_buckets, sizeof(CacheEntry*));
+    if( !buckets )
+        return false;
+    free(cache->buckets);
+    cache->buckets = buckets;
+    cache->num_buckets = num_buckets;
+    for( CacheEntry* entry = cache->first; entry; entry = entry->next )
+    {
+        CacheEntry** bucket = CacheGetBucket(cache, entry->hash);
+        entry->chain = *bucket;
+        *bucket = entry;
+    }
+    return true;
+}
+
+static void CacheRemove(GenerateCache* cache, CacheEntry* entry)
+{
+    CacheEntry** link = CacheGetBucket(cache, entry->hash);
+    while( *link != entry )
+        link = &(*link)->chain;
+    *link = entry->chain;
+
+    CacheUnlink(cache, entry);
+    cache->memory -= entry->memory;
+    cache->count--;
+    free(entry);
+}
+
+// Removes the least recently used entries until the cache is within the budget
+static void CacheTrim(GenerateCache* cache, uint32_t max_memory)
+{
+    while( cache->last && cache->memory > max_memory )
+    {
+        CacheRemove(cache, cache->last);
+        cache->evictions++;
+    }
+}
+
+static void CacheClear(GenerateCache* cache)
+{
+    while( cache->last )
+        CacheRemove(cache, cache->last);
+    free(cache->buckets);
+    cache->buckets = 0;
+    cache->num_buckets = 0;
+}
+
+// Finds a previously generated code, and marks it as the most recently used
+static CacheEntry* CacheFind(GenerateCache* cache, uint64_t hash, const char* text, uint32_t length, const uint32_t* options)
+{
+    if( !cache->num_buckets )
+        return 0;
+    for( CacheEntry* entry = *CacheGetBucket(cache, hash); entry; entry = entry->chain )
+    {
+        if( entry->hash != hash || entry->length != length )
+            continue;
+        if( memcmp(entry->options, options, sizeof(entry->options)) != 0 || memcmp(GetCacheText(entry), text, length) != 0 )
+            continue;
+        CacheUnlink(cache, entry);
+        CacheLinkFirst(cache, entry);
+        return entry;
+    }
+    return 0;
+}
+
+// Stores a copy of the code, and its image (if the images are cached)
+static void CacheInsert(GenerateCache* cache, uint64_t hash, const char* text, uint32_t length, const uint32_t* options,
+                        JCQRCode* qr, const uint8_t* image, uint32_t image_size)
 {
+    if( !cache->images )
+        image_size = 0;
+    uint32_t memory = (uint32_t)sizeof(CacheEntry) + length + qr->size * qr->size + image_size;
+    if( memory > cache->max_memory )
+        return;
+    CacheTrim(cache, cache->max_memory - memory);
+
+    if( cache->count >= cache->num_buckets && !CacheRehash(cache, cache->num_buckets ? cache->num_buckets * 2 : 64) && !cache->num_buckets )
+        return;
+
+    CacheEntry* entry = (CacheEntry*)malloc(memory);
+    if( !entry )
+        return;
+    entry->hash = hash;
+    memcpy(entry->options, options, sizeof(entry->options));
+    entry->qr = *qr;
+    entry->length = length;
+    entry->image_size = image_size;
+    entry->memory = memory;
+
+    memcpy(GetCacheText(entry), text, length);
+    uint8_t* modules = GetCacheText(entry) + length;
+    for( uint32_t y = 0; y < qr->size; ++y )
+    {
+        memcpy(modules + y * qr->size, qr->data + y * qr->stride, qr->size);
+    }
+    entry->qr.data = modules;
+    entry->qr.stride = qr->size;
+    if( image_size )
+        memcpy(GetCacheImage(entry), image, image_size);
+
+    CacheEntry** bucket = CacheGetBucket(cache, hash);
+    entry->chain = *bucket;
+    *bucket = entry;
+
+    CacheLinkFirst(cache, entry);
+    cache->memory += memory;
+    cache->count++;
+}
+
+static int SetCache(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 0);
+
+    lua_Integer max_memory = luaL_checkinteger(L, 1);
+    if( max_memory < 0 )
+    {
+        return DM_LUA_ERROR("qrcode.set_cache: 'max_memory' must not be negative");
+    }
+    bool images = lua_toboolean(L, 2) != 0;
+
+    GenerateCache* cache = &g_QRContext.cache;
+    if( images != cache->images )
+        CacheClear(cache);
+    cache->images = images;
+    cache->max_memory = (uint32_t)max_memory;
+    CacheTrim(cache, cache->max_memory);
+    return 0;
+}
+
+static int GetCacheStats(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 1);
+
+    GenerateCache* cache = &g_QRContext.cache;
+    lua_createtable(L, 0, 6);
+    lua_pushinteger(L, cache->hits);
+    lua_setfield(L, -2, "hits");
+    lua_pushinteger(L, cache->misses);
+    lua_setfield(L, -2, "misses");
+    lua_pushinteger(L, cache->evictions);
+    lua_setfield(L, -2, "evictions");
+    lua_pushinteger(L, cache->count);
+    lua_setfield(L, -2, "count");
+    lua_pushinteger(L, cache->memory);
+    lua_setfield(L, -2, "memory");
+    lua_pushinteger(L, cache->max_memory);
+    lua_setfield(L, -2, "max_memory");
+    return 1;
+}
+
+// A code to render, either from the encoder or from the cache
+struct GeneratedCode
+{
+    JCQRCode*   qr;     // Owned by the encoder context, or the cache
+    CacheEntry* entry;  // The cache entry, if the code was cached
+    uint64_t    hash;   // The cache key (if the cache is enabled)
+    uint32_t    options[QRCODE_CACHE_KEY_OPTIONS]; // The options of the cache key
+};
+
+// Finds the code in the cache, or encodes the text. Returns an error message if it failed
+static const char* GetCode(const char* text, uint32_t length, const GenerateOptions* options, GeneratedCode* code)
+{
+    GenerateCache* cache = &g_QRContext.cache;
+    code->entry = 0;
+    code->hash = 0;
+    if( cache->max_memory )
+    {
+        GetCacheKeyOptions(cache, options, code->options);
+        code->hash = CacheHashKey(text, length, code->options);
+        code->entry = CacheFind(cache, code->hash, text, length, code->options);
+    }
+
+    if( code->entry )
+    {
+        cache->hits++;
+        code->qr = &code->entry->qr;
+        return 0;
+    }
+
+    if( options->incremental )
+    {
+        if( !g_QRContext.updater )
+            g_QRContext.updater = jc_qrencode_create_context();
+        if( !g_QRContext.updater )
+            return "Failed to create encoder context";
+        code->qr = jc_qrencode_update(g_QRContext.updater, (const uint8_t*)text, length, &options->encoder);
+        if( !code->qr )
+            return "Failed to encode text";
+        return 0;
+    }
+
+    if( !GetEncoder() )
+        return "Failed to create encoder context";
+
+    code->qr = jc_qrencode_options_with_context(g_QRContext.encoder, (const uint8_t*)text, length, &options->encoder);
+    if( !code->qr )
+        return "Failed to encode text";
+    return 0;
+}
+
+// Renders the code into an image of GetImageBytes() bytes, and adds it to the cache if it wasn't cached
+static void WriteCode(GeneratedCode* code, const char* text, uint32_t length, const GenerateOptions* options, uint8_t* data)
+{
+    uint32_t size = GetImageBytes(code->qr, options);
+    if( code->entry && code->entry->image_size )
+        memcpy(data, GetCacheImage(code->entry), size);
+    else
+        RenderImage(code->qr, options, data);
+
+    GenerateCache* cache = &g_QRContext.cache;
+    if( !code->entry && cache->max_memory )
+    {
+        cache->misses++;
+        CacheInsert(cache, code->hash, text, length, code->options, code->qr, data, size);
+    }
+}
+
+static int Generate(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 3);
+
+    size_t textlength = 0;
+    const char* text = luaL_checklstring(L, 1, &textlength);
+    uint32_t length = (uint32_t)textlength;
+
+    GenerateOptions options;
+    const char* error = GetGenerateOptions(L, 2, &options);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate: %s", error);
+    }
+
+    GeneratedCode code;
+    error = GetCode(text, length, &options, &code);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate: %s: '%s'", error, text);
+    }
+
+    uint32_t outsize = GetImageSize(code.qr, &options);
+    dmBuffer::HBuffer buffer = CreateByteBuffer(GetImageBytes(code.qr, &options));
+    if( !buffer )
+    {
+        return DM_LUA_ERROR("qrcode.generate: Failed to create buffer");
+    }
+
+    uint8_t* data;
+    uint32_t datasize;
+    dmBuffer::GetBytes(buffer, (void**)&data, &datasize);
+    WriteCode(&code, text, length, &options, data);
+
+    // Transfer ownership to Lua
+    dmScript::LuaHBuffer luabuffer(buffer, dmScript::OWNER_LUA);
+    dmScript::PushBuffer(L, luabuffer);
+    lua_pushinteger(L, outsize);
+    lua_pushinteger(L, GetCodeImageSize(code.qr, &options));
+    return 3;
+}
+
+static int GenerateInto(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 2);
+
+    dmScript::LuaHBuffer* buffer = dmScript::CheckBuffer(L, 1);
+    size_t textlength = 0;
+    const char* text = luaL_checklstring(L, 2, &textlength);
+    uint32_t length = (uint32_t)textlength;
+
+    GenerateOptions options;
+    const char* error = GetGenerateOptions(L, 3, &options);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate_into: %s", error);
+    }
+
+    uint8_t* data;
+    uint32_t datasize;
+    if( !GetByteStream(buffer->m_Buffer, &data, &datasize) )
+    {
+        return DM_LUA_ERROR("qrcode.generate_into: The buffer must have a 'data' stream of type UINT8 * 1");
+    }
+
+    GeneratedCode code;
+    error = GetCode(text, length, &options, &code);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate_into: %s: '%s'", error, text);
+    }
+
+    uint32_t outsize = GetImageSize(code.qr, &options);
+    uint32_t outbytes = GetImageBytes(code.qr, &options);
+    if( datasize < outbytes )
+    {
+        return DM_LUA_ERROR("qrcode.generate_into: The buffer is too small: %u bytes, needs %u bytes", datasize, outbytes);
+    }
+
+    WriteCode(&code, text, length, &options, data);
+
+    lua_pushinteger(L, outsize);
+    lua_pushinteger(L, GetCodeImageSize(code.qr, &options));
+    return 2;
+}
+
+static int Plan(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 1);
+
+    size_t length = 0;
+    const char* text = luaL_checklstring(L, 1, &length);
+
+    GenerateOptions options;
+    const char* error = GetGenerateOptions(L, 2, &options);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.plan: %s", error);
+    }
+
+    if( !GetEncoder() )
+    {
+        return DM_LUA_ERROR("Failed to create encoder context");
+    }
+
+    JCQRCode* qr = jc_qrencode_plan(g_QRContext.encoder, (const uint8_t*)text, (uint32_t)length, &options.encoder);
+    if( !qr )
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    static const char* ecl_names[] = { "L", "M", "Q", "H" };
+
+    lua_createtable(L, 0, 6);
+    lua_pushinteger(L, qr->version);
+    lua_setfield(L, -2, "version");
+    lua_pushstring(L, ecl_names[qr->ecl]);
+    lua_setfield(L, -2, "ecl");
+    lua_pushinteger(L, qr->size);
+    lua_setfield(L, -2, "modules");
+    lua_pushinteger(L, GetImageSize(qr, &options));
+    lua_setfield(L, -2, "size");
+    lua_pushinteger(L, GetCodeImageSize(qr, &options));
+    lua_setfield(L, -2, "code_size");
+    lua_pushinteger(L, GetImageBytes(qr, &options));
+    lua_setfield(L, -2, "bytes");
+    return 1;
+}
+
+// GEOMETRY
+
+struct GeometryRect
+{
+    uint8_t x, y, w, h; // In modules, with y = 0 at the top row
+};
+
+// Merges the dark modules into rectangles: each rectangle is grown as wide as possible, then as tall as possible
+// Returns the number of rectangles. The 'rects' and 'visited' arrays must hold qr->size * qr->size entries
+static uint32_t MergeModules(JCQRCode* qr, GeometryRect* rects, uint8_t* visited)
+{
+    uint32_t size = qr->size;
+    memset(visited, 0, size * size);
+
+    uint32_t num_rects = 0;
+    for( uint32_t y = 0; y < size; ++y )
+    {
+        const uint8_t* modules = qr->data + y * qr->stride;
+        for( uint32_t x = 0; x < size; ++x )
+        {
+            if( modules[x] != 0 || visited[y*size + x] )
+                continue;
+
+            uint32_t w = 1;
+            while( x + w < size && modules[x + w] == 0 && !visited[y*size + x + w] )
+                ++w;
+
+            uint32_t h = 1;
+            for( ; y + h < size; ++h )
+            {
+                const uint8_t* next = qr->data + (y + h) * qr->stride;
+                uint32_t i = 0;
+                while( i < w && next[x + i] == 0 && !visited[(y + h)*size + x + i] )
+                    ++i;
+                if( i != w )
+                    break;
+            }
+
+            for( uint32_t j = 0; j < h; ++j )
+                memset(visited + (y + j)*size + x, 1, w);
+
+            GeometryRect* rect = &rects[num_rects++];
+            rect->x = (uint8_t)x;
+            rect->y = (uint8_t)y;
+            rect->w = (uint8_t)w;
+            rect->h = (uint8_t)h;
+        }
+    }
+    return num_rects;
+}
+
+// Pushes a flat array of x, y, w, h for each rectangle, with y = 0 at the bottom (as in the images)
+static void PushGeometryRects(lua_State* L, JCQRCode* qr, const GenerateOptions* options, const GeometryRect* rects, uint32_t num_rects)
+{
+    uint32_t scale = options->scale;
+    uint32_t border = options->border;
+    lua_createtable(L, (int)num_rects * 4, 0);
+    for( uint32_t i = 0; i < num_rects; ++i )
+    {
+        const GeometryRect* rect = &rects[i];
+        lua_pushinteger(L, (border + rect->x) * scale);
+        lua_rawseti(L, -2, i*4 + 1);
+        lua_pushinteger(L, (border + qr->size - rect->y - rect->h) * scale);
+        lua_rawseti(L, -2, i*4 + 2);
+        lua_pushinteger(L, rect->w * scale);
+        lua_rawseti(L, -2, i*4 + 3);
+        lua_pushinteger(L, rect->h * scale);
+        lua_rawseti(L, -2, i*4 + 4);
+    }
+}
+
+// Creates a buffer with a "position" stream of FLOAT32 * 3, with two triangles per rectangle
+static dmBuffer::HBuffer CreateGeometryMesh(JCQRCode* qr, const GenerateOptions* options, const GeometryRect* rects, uint32_t num_rects)
+{
+    dmBuffer::StreamDeclaration streams_decl[] = {
+        {QRCODE_STREAM_POSITION, dmBuffer::VALUE_TYPE_FLOAT32, 3}
+    };
+
+    uint32_t num_vertices = num_rects * 6;
+    dmBuffer::HBuffer buffer = 0;
+    dmBuffer::Result result = dmBuffer::Create(num_vertices ? num_vertices : 1, streams_decl, 1, &buffer);
+    if (result != dmBuffer::RESULT_OK )
+    {
+        return 0;
+    }
+
+    float* positions = 0;
+    uint32_t count = 0;
+    uint32_t components = 0;
+    uint32_t stride = 0;
+    if( dmBuffer::GetStream(buffer, QRCODE_STREAM_POSITION, (void**)&positions, &count, &components, &stride) != dmBuffer::RESULT_OK )
+    {
+        dmBuffer::Destroy(buffer);
+        return 0;
+    }
+    memset(positions, 0, count * stride * sizeof(float));
+
+    float scale = (float)options->scale;
+    for( uint32_t i = 0; i < num_rects; ++i )
+    {
+        const GeometryRect* rect = &rects[i];
+        float x0 = (options->border + rect->x) * scale;
+        float y0 = (options->border + qr->size - rect->y - rect->h) * scale;
+        float x1 = x0 + rect->w * scale;
+        float y1 = y0 + rect->h * scale;
+        // Counter clockwise
+        const float corners[6][2] = { {x0, y0}, {x1, y0}, {x1, y1}, {x0, y0}, {x1, y1}, {x0, y1} };
+        for( uint32_t v = 0; v < 6; ++v )
+        {
+            positions[0] = corners[v][0];
+            positions[1] = corners[v][1];
+            positions[2] = 0.0f;
+            positions += stride;
+        }
+    }
+    return buffer;
+}
+
+// Pushes an SVG path with a subpath per rectangle, with y = 0 at the top (as in SVG)
+static void PushGeometrySVG(lua_State* L, const GenerateOptions* options, const GeometryRect* rects, uint32_t num_rects)
+{
+    uint32_t scale = options->scale;
+    uint32_t border = options->border;
+    luaL_Buffer path;
+    luaL_buffinit(L, &path);
+    for( uint32_t i = 0; i < num_rects; ++i )
+    {
+        const GeometryRect* rect = &rects[i];
+        char subpath[64];
+        snprintf(subpath, sizeof(subpath), "M%u %uh%uv%uh-%uz", (border + rect->x) * scale, (border + rect->y) * scale,
+                    rect->w * scale, rect->h * scale, rect->w * scale);
+        luaL_addstring(&path, subpath);
+    }
+    luaL_pushresult(&path);
+}
+
+static int GenerateGeometry(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 2);
+
+    size_t textlength = 0;
+    const char* text = luaL_checklstring(L, 1, &textlength);
+    uint32_t length = (uint32_t)textlength;
+
+    GenerateOptions options;
+    const char* error = GetGenerateOptions(L, 2, &options);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate_geometry: %s", error);
+    }
+
+    const char* type = "rects";
+    if( lua_istable(L, 2) )
+    {
+        lua_getfield(L, 2, "geometry");
+        if( !lua_isnil(L, -1) )
+            type = lua_tostring(L, -1);
+        lua_pop(L, 1);
+    }
+    if( !type || (strcmp(type, "rects") != 0 && strcmp(type, "mesh") != 0 && strcmp(type, "svg") != 0) )
+    {
+        return DM_LUA_ERROR("qrcode.generate_geometry: 'geometry' must be one of \"rects\", \"mesh\" or \"svg\"");
+    }
+
+    GeneratedCode code;
+    error = GetCode(text, length, &options, &code);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate_geometry: %s: '%s'", error, text);
+    }
+
+    uint32_t num_modules = code.qr->size * code.qr->size;
+    uint8_t* memory = (uint8_t*)malloc(num_modules * (sizeof(GeometryRect) + 1));
+    if( !memory )
+    {
+        return DM_LUA_ERROR("qrcode.generate_geometry: Failed to allocate memory");
+    }
+    GeometryRect* rects = (GeometryRect*)memory;
+    uint32_t num_rects = MergeModules(code.qr, rects, memory + num_modules * sizeof(GeometryRect));
+
+    if( strcmp(type, "mesh") == 0 )
+    {
+        dmBuffer::HBuffer buffer = CreateGeometryMesh(code.qr, &options, rects, num_rects);
+        if( !buffer )
+        {
+            free(memory);
+            return DM_LUA_ERROR("qrcode.generate_geometry: Failed to create buffer");
+        }
+        dmScript::LuaHBuffer luabuffer(buffer, dmScript::OWNER_LUA);
+        dmScript::PushBuffer(L, luabuffer);
+    }
+    else if( strcmp(type, "svg") == 0 )
+    {
+        PushGeometrySVG(L, &options, rects, num_rects);
+    }
+    else
+    {
+        PushGeometryRects(L, code.qr, &options, rects, num_rects);
+    }
+    lua_pushinteger(L, GetCodeImageSize(code.qr, &options));
+    free(memory);
+
+    // Only the modules are cached
+    GenerateCache* cache = &g_QRContext.cache;
+    if( !code.entry && cache->max_memory )
+    {
+        cache->misses++;
+        CacheInsert(cache, code.hash, text, length, code.options, code.qr, 0, 0);
+    }
+    return 2;
+}
+
+// BATCH GENERATE
+
+struct BatchJob
+{
+    const char* text;
+    uint32_t    length;
+    uint32_t    size;   // The size of the image (0 if it failed)
+    uint32_t    bytes;  // The size of the image, in bytes
+    uint8_t*    image;  // malloc'ed, handed over to a buffer on the main thread
+};
+
+struct BatchContext
+{
+    BatchJob*       jobs;
+    uint32_t        num_jobs;
+    uint32_t        next_job;
+    dmMutex::HMutex mutex;
+    const GenerateOptions* options;
+};
+
+struct BatchWorker
+{
+    BatchContext*       batch;
+    JCQRCodeContext*    encoder;
+};
+
+static void BatchWorkerMain(void* _worker)
+{
+    BatchWorker* worker = (BatchWorker*)_worker;
+    BatchContext* batch = worker->batch;
+    while( true )
+    {
+        uint32_t index;
+        if( batch->mutex )
+            dmMutex::Lock(batch->mutex);
+        index = batch->next_job++;
+        if( batch->mutex )
+            dmMutex::Unlock(batch->mutex);
+        if( index >= batch->num_jobs )
+            break;
+
+        BatchJob* job = &batch->jobs[index];
+        JCQRCode* qr = jc_qrencode_options_with_context(worker->encoder, (const uint8_t*)job->text, job->length, &batch->options->encoder);
+        if( !qr )
+            continue;
+        job->bytes = GetImageBytes(qr, batch->options);
+        job->image = (uint8_t*)malloc(job->bytes);
+        if( !job->image )
+            continue;
+        RenderImage(qr, batch->options, job->image);
+        job->size = GetImageSize(qr, batch->options);
+    }
+}
+
+// Gets the number of threads from the options table at the index (if any)
+static uint32_t GetBatchThreads(lua_State* L, int index)
+{
+    uint32_t num_threads = QRCODE_DEFAULT_WORKERS;
+    if( lua_istable(L, index) )
+    {
+        lua_getfield(L, index, "threads");
+        if( !lua_isnil(L, -1) )
+            num_threads = (uint32_t)luaL_checkint(L, -1);
+        lua_pop(L, 1);
+    }
+#if defined(DM_PLATFORM_HTML5)
+    num_threads = 1; // no threads
+#endif
+    if( num_threads < 1 )
+        num_threads = 1;
+    if( num_threads > QRCODE_MAX_WORKERS )
+        num_threads = QRCODE_MAX_WORKERS;
+    return num_threads;
+}
+
+// Creates a job for each string in the table at the index.
+// Returns 0 if it failed, with 'invalid_entry' set to the entry that wasn't a string (or 0 if the allocation failed)
+// The strings are owned by the table, which must stay alive while the jobs are used
+static BatchJob* CreateBatchJobs(lua_State* L, int index, uint32_t* num_jobs, uint32_t* invalid_entry)
+{
+    uint32_t count = (uint32_t)lua_objlen(L, index);
+    *num_jobs = count;
+    *invalid_entry = 0;
+    BatchJob* jobs = (BatchJob*)malloc(sizeof(BatchJob) * (count ? count : 1));
+    if( !jobs )
+        return 0;
+    for( uint32_t i = 0; i < count; ++i )
+    {
+        // Only actual strings, since a converted number would only be referenced by the stack slot that is popped
+        lua_rawgeti(L, index, i+1);
+        size_t length = 0;
+        const char* text = lua_type(L, -1) == LUA_TSTRING ? lua_tolstring(L, -1, &length) : 0;
+        lua_pop(L, 1);
+        if( !text )
+        {
+            free(jobs);
+            *invalid_entry = i+1;
+            return 0;
+        }
+        jobs[i].text = text;
+        jobs[i].length = (uint32_t)length;
+        jobs[i].size = 0;
+        jobs[i].bytes = 0;
+        jobs[i].image = 0;
+    }
+    return jobs;
+}
+
+static void DestroyBatchJobs(BatchJob* jobs, uint32_t num_jobs)
+{
+    for( uint32_t i = 0; i < num_jobs; ++i )
+    {
+        free(jobs[i].image);
+    }
+    free(jobs);
+}
+
+// Encodes and renders the jobs using a number of threads (including the calling thread)
+// Returns false if no encoder could be created
+static bool RunBatchJobs(BatchJob* jobs, uint32_t num_jobs, const GenerateOptions* options, uint32_t num_threads)
+{
+    if( num_threads > num_jobs )
+        num_threads = num_jobs ? num_jobs : 1;
+
+    for( uint32_t i = 0; i < num_threads; ++i )
+    {
+        if( !g_QRContext.workers[i] )
+            g_QRContext.workers[i] = jc_qrencode_create_context();
+        if( !g_QRContext.workers[i] )
+        {
+            num_threads = i;
+            break;
+        }
+    }
+    if( num_threads == 0 )
+        return false;
+
+    BatchContext batch;
+    batch.jobs = jobs;
+    batch.num_jobs = num_jobs;
+    batch.next_job = 0;
+    batch.mutex = num_threads > 1 ? dmMutex::New() : 0;
+    batch.options = options;
+
+    // The calling thread is the first worker
+    BatchWorker workers[QRCODE_MAX_WORKERS];
+    dmThread::Thread threads[QRCODE_MAX_WORKERS];
+    for( uint32_t i = 0; i < num_threads; ++i )
+    {
+        workers[i].batch = &batch;
+        workers[i].encoder = g_QRContext.workers[i];
+    }
+    // If a thread fails to start, the started threads (and the calling thread) take its jobs
+    uint32_t num_started = 0;
+    for( uint32_t i = 1; i < num_threads; ++i )
+    {
+        dmThread::Thread thread = dmThread::New(BatchWorkerMain, 0x10000, &workers[i], "qrcode_batch");
+        if( thread )
+            threads[num_started++] = thread;
+    }
+    BatchWorkerMain(&workers[0]);
+    for( uint32_t i = 0; i < num_started; ++i )
+    {
+        dmThread::Join(threads[i]);
+    }
+    if( batch.mutex )
+        dmMutex::Delete(batch.mutex);
+    return true;
+}
+
+static int GenerateBatch(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 2);
+
+    luaL_checktype(L, 1, LUA_TTABLE);
+
+    GenerateOptions options;
+    const char* error = GetGenerateOptions(L, 2, &options);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate_batch: %s", error);
+    }
+    uint32_t num_threads = GetBatchThreads(L, 2);
+
+    uint32_t num_jobs;
+    uint32_t invalid_entry;
+    BatchJob* jobs = CreateBatchJobs(L, 1, &num_jobs, &invalid_entry);
+    if( !jobs )
+    {
+        if( invalid_entry )
+            return DM_LUA_ERROR("qrcode.generate_batch: Entry %u is not a string", invalid_entry);
+        return DM_LUA_ERROR("qrcode.generate_batch: Failed to allocate %u jobs", num_jobs);
+    }
+
+    if( !RunBatchJobs(jobs, num_jobs, &options, num_threads) )
+    {
+        DestroyBatchJobs(jobs, num_jobs);
+        return DM_LUA_ERROR("Failed to create encoder context");
+    }
+
+    // Create the buffers on the main thread
+    lua_createtable(L, (int)num_jobs, 0);
+    lua_createtable(L, (int)num_jobs, 0);
+    for( uint32_t i = 0; i < num_jobs; ++i )
+    {
+        BatchJob* job = &jobs[i];
+        dmBuffer::HBuffer buffer = job->image ? CreateByteBuffer(job->bytes) : 0;
+        if( buffer )
+        {
+            uint8_t* data;
+            uint32_t datasize;
+            dmBuffer::GetBytes(buffer, (void**)&data, &datasize);
+            memcpy(data, job->image, job->bytes);
+
+            dmScript::LuaHBuffer luabuffer(buffer, dmScript::OWNER_LUA);
+            dmScript::PushBuffer(L, luabuffer);
+            lua_rawseti(L, -3, i+1);
+            lua_pushinteger(L, job->size);
+            lua_rawseti(L, -2, i+1);
+        }
+        else
+        {
+            lua_pushboolean(L, 0);
+            lua_rawseti(L, -3, i+1);
+            lua_pushinteger(L, 0);
+            lua_rawseti(L, -2, i+1);
+        }
+    }
+    DestroyBatchJobs(jobs, num_jobs);
+    return 2;
+}
+
+// ATLAS
+
+struct AtlasCell
+{
+    uint32_t index; // The job
+    uint32_t size;
+    uint32_t x;
+    uint32_t y;
+};
+
+// Sorts the cells by decreasing size, keeping the order of the texts for equal sizes
+static int CompareAtlasCells(const void* _a, const void* _b)
+{
+    const AtlasCell* a = (const AtlasCell*)_a;
+    const AtlasCell* b = (const AtlasCell*)_b;
+    if( a->size != b->size )
+        return a->size > b->size ? -1 : 1;
+    return a->index < b->index ? -1 : (a->index > b->index ? 1 : 0);
+}
+
+static uint32_t NextPowerOfTwo(uint32_t value)
+{
+    uint32_t pow2 = 1;
+    while( pow2 < value )
+        pow2 <<= 1;
+    return pow2;
+}
+
+// Places the cells on shelves of at most 'width' texels, from the bottom up. Returns the height used
+static uint32_t PackAtlasShelves(AtlasCell* cells, uint32_t num_cells, uint32_t width)
+{
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t shelf_height = 0;
+    for( uint32_t i = 0; i < num_cells; ++i )
+    {
+        AtlasCell* cell = &cells[i];
+        if( x + cell->size > width )
+        {
+            y += shelf_height;
+            x = 0;
+            shelf_height = 0;
+        }
+        cell->x = x;
+        cell->y = y;
+        x += cell->size;
+        if( cell->size > shelf_height )
+            shelf_height = cell->size;
+    }
+    return y + shelf_height;
+}
+
+static void PushAtlasRect(lua_State* L, const AtlasCell* cell, uint32_t width, uint32_t height)
+{
+    lua_createtable(L, 0, 8);
+    lua_pushinteger(L, cell->x);
+    lua_setfield(L, -2, "x");
+    lua_pushinteger(L, cell->y);
+    lua_setfield(L, -2, "y");
+    lua_pushinteger(L, cell->size);
+    lua_setfield(L, -2, "w");
+    lua_pushinteger(L, cell->size);
+    lua_setfield(L, -2, "h");
+    lua_pushnumber(L, cell->x / (lua_Number)width);
+    lua_setfield(L, -2, "u0");
+    lua_pushnumber(L, cell->y / (lua_Number)height);
+    lua_setfield(L, -2, "v0");
+    lua_pushnumber(L, (cell->x + cell->size) / (lua_Number)width);
+    lua_setfield(L, -2, "u1");
+    lua_pushnumber(L, (cell->y + cell->size) / (lua_Number)height);
+    lua_setfield(L, -2, "v1");
+}
+
+static int GenerateAtlas(lua_State* L)
+{
+    DM_LUA_STACK_CHECK(L, 4);
+
+    luaL_checktype(L, 1, LUA_TTABLE);
+
+    GenerateOptions options;
+    const char* error = GetGenerateOptions(L, 2, &options);
+    if( error )
+    {
+        return DM_LUA_ERROR("qrcode.generate_atlas: %s", error);
+    }
+    uint32_t num_threads = GetBatchThreads(L, 2);
+
+    if( IsBlockFormat(options.format) )
+    {
+        return DM_LUA_ERROR("qrcode.generate_atlas: Only the \"luminance\" and \"sdf\" formats are supported");
+    }
+
+    // The atlas is padded to a power of two size, not the codes
+    bool pow2 = options.pow2;
+    options.pow2 = false;
+
+    uint32_t width = 0;
+    if( lua_istable(L, 2) )
+    {
+        lua_getfield(L, 2, "width");
+        if( !lua_isnil(L, -1) )
+        {
+            lua_Integer value = lua_tointeger(L, -1);
+            if( value < 1 )
+            {
+                lua_pop(L, 1);
+                return DM_LUA_ERROR("qrcode.generate_atlas: 'width' must be positive");
+            }
+            width = (uint32_t)value;
+        }
+        lua_pop(L, 1);
+    }
+
+    uint32_t num_jobs;
+    uint32_t invalid_entry;
+    BatchJob* jobs = CreateBatchJobs(L, 1, &num_jobs, &invalid_entry);
+    if( !jobs )
+    {
+        if( invalid_entry )
+            return DM_LUA_ERROR("qrcode.generate_atlas: Entry %u is not a string", invalid_entry);
+        return DM_LUA_ERROR("qrcode.generate_atlas: Failed to allocate %u jobs", num_jobs);
+    }
+
+    if( !RunBatchJobs(jobs, num_jobs, &options, num_threads) )
+    {
+        DestroyBatchJobs(jobs, num_jobs);
+        return DM_LUA_ERROR("Failed to create encoder context");
+    }
+
+    AtlasCell* cells = (AtlasCell*)malloc(sizeof(AtlasCell) * (num_jobs ? num_jobs : 1));
+    if( !cells )
+    {
+        DestroyBatchJobs(jobs, num_jobs);
+        return DM_LUA_ERROR("qrcode.generate_atlas: Failed to allocate %u cells", num_jobs);
+    }
+
+    uint32_t num_cells = 0;
+    uint32_t max_size = 0;
+    double area = 0;
+    for( uint32_t i = 0; i < num_jobs; ++i )
+    {
+        if( !jobs[i].image )
+            continue;
+        AtlasCell* cell = &cells[num_cells++];
+        cell->index = i;
+        cell->size = jobs[i].size;
+        if( cell->size > max_size )
+            max_size = cell->size;
+        area += (double)cell->size * cell->size;
+    }
+    qsort(cells, num_cells, sizeof(AtlasCell), CompareAtlasCells);
+
+    if( width == 0 )
+    {
+        // Roughly square, and a whole number of the largest codes wide (which makes a grid if the codes have the same size)
+        uint32_t columns = max_size ? (uint32_t)ceil(sqrt(area) / max_size) : 1;
+        width = columns * max_size;
+        if( width == 0 )
+            width = 1;
+        if( pow2 )
+            width = NextPowerOfTwo(width);
+    }
+    else if( max_size > width )
+    {
+        free(cells);
+        DestroyBatchJobs(jobs, num_jobs);
+        return DM_LUA_ERROR("qrcode.generate_atlas: A code is %u texels, which is larger than the atlas width %u", max_size, width);
+    }
+
+    uint32_t height = PackAtlasShelves(cells, num_cells, width);
+    if( height == 0 )
+        height = 1;
+    if( pow2 )
+        height = NextPowerOfTwo(height);
+
+    dmBuffer::HBuffer buffer = CreateByteBuffer(width * height);
+    if( !buffer )
+    {
+        free(cells);
+        DestroyBatchJobs(jobs, num_jobs);
+        return DM_LUA_ERROR("qrcode.generate_atlas: Failed to create a buffer of %u x %u", width, height);
+    }
+
+    uint8_t* data;
+    uint32_t datasize;
+    dmBuffer::GetBytes(buffer, (void**)&data, &datasize);
+    memset(data, options.format == QRCODE_FORMAT_SDF ? 0 : 255, width * height); // light
+    for( uint32_t i = 0; i < num_cells; ++i )
+    {
+        const AtlasCell* cell = &cells[i];
+        const uint8_t* image = jobs[cell->index].image;
+        for( uint32_t y = 0; y < cell->size; ++y )
+        {
+            memcpy(data + (cell->y + y) * width + cell->x, image + y * cell->size, cell->size);
+        }
+    }
+
+    dmScript::LuaHBuffer luabuffer(buffer, dmScript::OWNER_LUA);
+    dmScript::PushBuffer(L, luabuffer);
+    lua_pushinteger(L, width);
+    lua_pushinteger(L, height);
+
+    lua_createtable(L, (int)num_jobs, 0);
+    for( uint32_t i = 0; i < num_jobs; ++i )
+    {
+        lua_pushboolean(L, 0);
+        lua_rawseti(L, -2, i+1);
+    }
+    for( uint32_t i = 0; i < num_cells; ++i )
+    {
+        PushAtlasRect(L, &cells[i], width, height);
+        lua_rawseti(L, -2, cells[i].index+1);
+    }
+
+    free(cells);
+    DestroyBatchJobs(jobs, num_jobs);
+    return 4;
+}
+
+static const luaL_reg Module_methods[] =
+{
+    {"scan", Scan},
+    {"generate", Generate},
+    {"generate_into", GenerateInto},
+    {"generate_batch", GenerateBatch},
+    {"generate_atlas", GenerateAtlas},
+    {"generate_geometry", GenerateGeometry},
+    {"plan", Plan},
+    {"set_cache", SetCache},
+    {"get_cache_stats", GetCacheStats},
+    {0, 0}
+};
+
+static void LuaInit(lua_State* L)
+{
+    int top = lua_gettop(L);
+    luaL_register(L, MODULE_NAME, Module_methods);
+
+#define SETCONSTANT(name) \
+        lua_pushnumber(L, (lua_Number) name); \
+        lua_setfield(L, -2, #name);\
+
+#undef SETCONSTANT
+
+    lua_pop(L, 1);
+    assert(top == lua_gettop(L));
+}
+
+dmExtension::Result AppInitializeQRCode(dmExtension::AppParams* params)
+{
+    return dmExtension::RESULT_OK;
+}
+
+dmExtension::Result InitializeQRCode(dmExtension::Params* params)
+{
+    LuaInit(params->m_L);
+    return dmExtension::RESULT_OK;
+}
+
+dmExtension::Result AppFinalizeQRCode(dmExtension::AppParams* params)
+{
+    if (g_QRContext.qr)
+        quirc_destroy(g_QRContext.qr);
+    g_QRContext.qr = 0;
+    quirc_set_kanji_decoder(0);
+    free(g_QRContext.kanji_unicode);
+    g_QRContext.kanji_unicode = 0;
+    if (g_QRContext.encoder)
+        jc_qrencode_destroy_context(g_QRContext.encoder);
+    g_QRContext.encoder = 0;
+    if (g_QRContext.updater)
+        jc_qrencode_destroy_context(g_QRContext.updater);
+    g_QRContext.updater = 0;
+    CacheClear(&g_QRContext.cache);
+    g_QRContext.cache.max_memory = 0;
+    for (uint32_t i = 0; i < QRCODE_MAX_WORKERS; ++i)
+    {
+        if (g_QRContext.workers[i])
+            jc_qrencode_destroy_context(g_QRContext.workers[i]);
+        g_QRContext.workers[i] = 0;
+    }
     return dmExtension::RESULT_OK;
 }
 
@@ -125,10 +125,22 @@ const static struct galois_field gf256 = {
 
 /************************************************************************
  * Polynomial operations
+ *
+ * Polynomials are stored lowest coefficient first. Callers pass the
+ * number of coefficients which may be nonzero, so that the work done is
+ * bounded by the actual degree rather than by MAX_POLY.
  */
 
-static void poly_add(uint8_t *dst, const uint8_t *src, uint8_t c,
-		     int shift, const struct galois_field *gf)
+static int poly_degree(const uint8_t *p, int len)
+{
+	while (len > 0 && !p[len - 1])
+		len--;
+
+	return len - 1;
+}
+
+static void poly_add(uint8_t *dst, const uint8_t *src, int src_len,
+		     uint8_t c, int shift, const struct galois_field *gf)
 {
 	int i;
 	int log_c = gf->log[c];
@@ -136,36 +148,45 @@ static void poly_add(uint8_t *dst, const uint8_t *src, uint8_t c,
 	if (!c)
 		return;
 
-	for (i = 0; i < MAX_POLY; i++) {
-		int p = i + shift;
+	if (src_len > MAX_POLY - shift)
+		src_len = MAX_POLY - shift;
+
+	for (i = 0; i < src_len; i++) {
 		uint8_t v = src[i];
+		int l;
 
-		if (p < 0 || p >= MAX_POLY)
-			continue;
 		if (!v)
 			continue;
 
-		dst[p] ^= gf->exp[(gf->log[v] + log_c) % gf->p];
+		l = gf->log[v] + log_c;
+		if (l >= gf->p)
+			l -= gf->p;
+
+		dst[i + shift] ^= gf->exp[l];
 	}
 }
 
-static uint8_t poly_eval(const uint8_t *s, uint8_t x,
+static uint8_t poly_eval(const uint8_t *s, int deg, uint8_t x,
 			 const struct galois_field *gf)
 {
 	int i;
 	uint8_t sum = 0;
-	uint8_t log_x = gf->log[x];
+	int log_x = gf->log[x];
 
 	if (!x)
-		return s[0];
+		return deg >= 0 ? s[0] : 0;
 
-	for (i = 0; i < MAX_POLY; i++) {
-		uint8_t c = s[i];
+	/* Horner's rule, highest coefficient first */
+	for (i = deg; i >= 0; i--) {
+		if (sum) {
+			int l = gf->log[sum] + log_x;
 
-		if (!c)
-			continue;
+			if (l >= gf->p)
+				l -= gf->p;
+			sum = gf->exp[l];
+		}
 
-		sum ^= gf->exp[(gf->log[c] + log_x * i) % gf->p];
+		sum ^= s[i];
 	}
 
 	return sum;
@@ -173,14 +194,18 @@ static uint8_t poly_eval(const uint8_t *s, uint8_t x,
 
 /************************************************************************
  * Berlekamp-Massey algorithm for finding error locator polynomials.
+ *
+ * Returns the number of errors L. The degree of sigma is at most L.
  */
 
-static void berlekamp_massey(const uint8_t *s, int N,
-			     const struct galois_field *gf,
-			     uint8_t *sigma)
+static int berlekamp_massey(const uint8_t *s, int N,
+			    const struct galois_field *gf,
+			    uint8_t *sigma)
 {
 	uint8_t C[MAX_POLY];
 	uint8_t B[MAX_POLY];
+	int C_len = 1;
+	int B_len = 1;
 	int L = 0;
 	int m = 1;
 	uint8_t b = 1;
@@ -197,34 +222,51 @@ static void berlekamp_massey(const uint8_t *s, int N,
 		int i;
 
 		for (i = 1; i <= L; i++) {
+			int l;
+
 			if (!(C[i] && s[n - i]))
 				continue;
 
-			d ^= gf->exp[(gf->log[C[i]] +
-				      gf->log[s[n - i]]) %
-				     gf->p];
+			l = gf->log[C[i]] + gf->log[s[n - i]];
+			if (l >= gf->p)
+				l -= gf->p;
+			d ^= gf->exp[l];
 		}
 
-		mult = gf->exp[(gf->p - gf->log[b] + gf->log[d]) % gf->p];
-
 		if (!d) {
 			m++;
-		} else if (L * 2 <= n) {
-			uint8_t T[MAX_POLY];
+			continue;
+		}
+
+		mult = gf->exp[(gf->p - gf->log[b] + gf->log[d]) % gf->p];
 
-			memcpy(T, C, sizeof(T));
-			poly_add(C, B, mult, m, gf);
-			memcpy(B, T, sizeof(B));
+		if (L * 2 <= n) {
+			uint8_t T[MAX_POLY];
+			int T_len = C_len;
+
+			memcpy(T, C, C_len);
+			poly_add(C, B, B_len, mult, m, gf);
+			if (B_len + m > C_len)
+				C_len = B_len + m < MAX_POLY ?
+					B_len + m : MAX_POLY;
+			memcpy(B, T, T_len);
+			if (T_len < B_len)
+				memset(B + T_len, 0, B_len - T_len);
+			B_len = T_len;
 			L = n + 1 - L;
 			b = d;
 			m = 1;
 		} else {
-			poly_add(C, B, mult, m, gf);
+			poly_add(C, B, B_len, mult, m, gf);
+			if (B_len + m > C_len)
+				C_len = B_len + m < MAX_POLY ?
+					B_len + m : MAX_POLY;
 			m++;
 		}
 	}
 
 	memcpy(sigma, C, MAX_POLY);
+	return L;
 }
 
 /************************************************************************
@@ -261,32 +303,32 @@ static int block_syndromes(const uint8_t *data, int bs, int npar, uint8_t *s)
 }
 
 static void eloc_poly(uint8_t *omega,
-		      const uint8_t *s, const uint8_t *sigma,
+		      const uint8_t *s, const uint8_t *sigma, int sigma_deg,
 		      int npar)
 {
 	int i;
 
 	memset(omega, 0, MAX_POLY);
 
-	for (i = 0; i < npar; i++) {
+	for (i = 0; i <= sigma_deg && i < npar; i++) {
 		const uint8_t a = sigma[i];
-		const uint8_t log_a = gf256_log[a];
+		const int log_a = gf256_log[a];
 		int j;
 
 		if (!a)
 			continue;
 
-		for (j = 0; j + 1 < MAX_POLY; j++) {
+		for (j = 0; i + j < npar; j++) {
 			const uint8_t b = s[j + 1];
-
-			if (i + j >= npar)
-				break;
+			int l;
 
 			if (!b)
 				continue;
 
-			omega[i + j] ^=
-			    gf256_exp[(log_a + gf256_log[b]) % 255];
+			l = log_a + gf256_log[b];
+			if (l >= 255)
+				l -= 255;
+			omega[i + j] ^= gf256_exp[l];
 		}
 	}
 }
@@ -299,36 +341,81 @@ static quirc_decode_error_t correct_block(uint8_t *data,
 	uint8_t sigma[MAX_POLY];
 	uint8_t sigma_deriv[MAX_POLY];
 	uint8_t omega[MAX_POLY];
+	int term_log[MAX_POLY];
+	int term_pow[MAX_POLY];
+	int nterms = 0;
+	int found = 0;
+	int deg;
 	int i;
 
 	/* Compute syndrome vector */
 	if (!block_syndromes(data, ecc->bs, npar, s))
 		return QUIRC_SUCCESS;
 
-	berlekamp_massey(s, npar, &gf256, sigma);
+	deg = berlekamp_massey(s, npar, &gf256, sigma);
+
+	/* More errors than the parity can locate, or a locator which
+	 * doesn't have the degree it claims: don't bother searching.
+	 */
+	if (deg * 2 > npar || poly_degree(sigma, deg + 1) != deg)
+		return QUIRC_ERROR_DATA_ECC;
 
 	/* Compute derivative of sigma */
 	memset(sigma_deriv, 0, MAX_POLY);
-	for (i = 0; i + 1 < MAX_POLY; i += 2)
+	for (i = 0; i + 1 <= deg; i += 2)
 		sigma_deriv[i] = sigma[i + 1];
 
 	/* Compute error evaluator polynomial */
-	eloc_poly(omega, s, sigma, npar - 1);
+	eloc_poly(omega, s, sigma, deg, npar - 1);
 
-	/* Find error locations and magnitudes */
-	for (i = 0; i < ecc->bs; i++) {
-		uint8_t xinv = gf256_exp[255 - i];
+	/* Chien search. Each nonzero term sigma_k * x^k is kept in log form
+	 * and stepped from x = a^-i to x = a^-(i+1) by multiplying it by
+	 * a^-k, which is one addition per term and position. We stop as
+	 * soon as all deg roots have been found.
+	 */
+	for (i = 1; i <= deg; i++) {
+		if (!sigma[i])
+			continue;
+
+		term_log[nterms] = gf256_log[sigma[i]];
+		term_pow[nterms] = 255 - i;
+		nterms++;
+	}
 
-		if (!poly_eval(sigma, xinv, &gf256)) {
-			uint8_t sd_x = poly_eval(sigma_deriv, xinv, &gf256);
-			uint8_t omega_x = poly_eval(omega, xinv, &gf256);
-			uint8_t error = gf256_exp[(255 - gf256_log[sd_x] +
-						   gf256_log[omega_x]) % 255];
+	for (i = 0; i < ecc->bs && found < deg; i++) {
+		uint8_t sum = sigma[0];
+		int t;
+
+		for (t = 0; t < nterms; t++) {
+			sum ^= gf256_exp[term_log[t]];
+
+			term_log[t] += term_pow[t];
+			if (term_log[t] >= 255)
+				term_log[t] -= 255;
+		}
+
+		if (!sum) {
+			uint8_t xinv = gf256_exp[255 - i];
+			uint8_t sd_x = poly_eval(sigma_deriv, deg - 1,
+						 xinv, &gf256);
+			uint8_t omega_x = poly_eval(omega, npar - 2,
+						    xinv, &gf256);
+			uint8_t error;
+
+			if (!sd_x)
+				return QUIRC_ERROR_DATA_ECC;
+
+			error = gf256_exp[(255 - gf256_log[sd_x] +
+					   gf256_log[omega_x]) % 255];
 
 			data[ecc->bs - i - 1] ^= error;
+			found++;
 		}
 	}
 
+	if (found != deg)
+		return QUIRC_ERROR_DATA_ECC;
+
 	if (block_syndromes(data, ecc->bs, npar, s))
 		return QUIRC_ERROR_DATA_ECC;
 
@@ -370,6 +457,7 @@ static int format_syndromes(uint16_t u, uint8_t *s)
 static quirc_decode_error_t correct_format(uint16_t *f_ret)
 {
 	uint16_t u = *f_ret;
+	int deg;
 	int i;
 	uint8_t s[MAX_POLY];
 	uint8_t sigma[MAX_POLY];
@@ -380,11 +468,11 @@ static quirc_decode_error_t correct_format(uint16_t *f_ret)
 	if (!format_syndromes(u, s))
 		return QUIRC_SUCCESS;
 
-	berlekamp_massey(s, FORMAT_SYNDROMES, &gf16, sigma);
+	deg = berlekamp_massey(s, FORMAT_SYNDROMES, &gf16, sigma);
 
 	/* Now, find the roots of the polynomial */
 	for (i = 0; i < 15; i++)
-		if (!poly_eval(sigma, gf16_exp[15 - i], &gf16))
+		if (!poly_eval(sigma, deg, gf16_exp[15 - i], &gf16))
 			u ^= (1 << i);
 
 	if (format_syndromes(u, s))
@@ -404,6 +492,10 @@ struct datastream {
 	int		ptr;
 
 	uint8_t         data[QUIRC_MAX_PAYLOAD];
+
+	/* Where the decoded payload goes, and how many bytes fit there */
+	uint8_t		*payload;
+	int		payload_max;
 };
 
 static inline int grid_bit(const struct quirc_code *code, int x, int y)
@@ -542,14 +634,20 @@ static void read_bit(const struct quirc_code *code,
 	ds->data_bits++;
 }
 
-static void read_data(const struct quirc_code *code,
-		      struct quirc_data *data,
-		      struct datastream *ds)
+static void read_data_direct(const struct quirc_code *code,
+			     struct quirc_data *data,
+			     struct datastream *ds)
 {
 	int y = code->size - 1;
 	int x = code->size - 1;
 	int dir = -1;
 
+	/* Bits are ORed in, so clear what we'll touch, including the
+	 * remainder bits.
+	 */
+	memset(ds->raw, 0, quirc_version_db[data->version].data_bytes + 1);
+	ds->data_bits = 0;
+
 	while (x > 0) {
 		if (x == 6)
 			x--;
@@ -569,6 +667,180 @@ static void read_data(const struct quirc_code *code,
 	}
 }
 
+/************************************************************************
+ * Read plans
+ *
+ * The order in which data modules are read, and the value of each mask
+ * at those modules, only depend on the version. A plan records the cell
+ * index of every data bit, plus the eight masks packed in codeword bit
+ * order, so that reading the data is a gather followed by a word-wide
+ * XOR. Plans are built the first time a version is seen and are kept
+ * for the lifetime of the process.
+ */
+
+struct read_plan {
+	int		num_bits;
+	int		num_bytes;	/* Rounded up to a whole word */
+	uint8_t		*masks;		/* 8 planes of num_bytes each */
+	uint16_t	*cells;		/* num_bits cell indices */
+};
+
+static struct read_plan *read_plans[QUIRC_MAX_VERSION + 1];
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define plan_load(p)		(*(struct read_plan * volatile *)(p))
+#define plan_publish(p, v)	(_InterlockedCompareExchangePointer( \
+					(void * volatile *)(p), (v), NULL) == NULL)
+#else
+#define plan_load(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+static int plan_publish(struct read_plan **p, struct read_plan *v)
+{
+	struct read_plan *expected = NULL;
+
+	return __atomic_compare_exchange_n(p, &expected, v, 0,
+					   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+#endif
+
+static int plan_cells(int version, uint16_t *cells)
+{
+	int size = version * 4 + 17;
+	int y = size - 1;
+	int x = size - 1;
+	int dir = -1;
+	int n = 0;
+
+	while (x > 0) {
+		if (x == 6)
+			x--;
+
+		if (!reserved_cell(version, y, x)) {
+			if (cells)
+				cells[n] = y * size + x;
+			n++;
+		}
+
+		if (!reserved_cell(version, y, x - 1)) {
+			if (cells)
+				cells[n] = y * size + x - 1;
+			n++;
+		}
+
+		y += dir;
+		if (y < 0 || y >= size) {
+			dir = -dir;
+			x -= 2;
+			y += dir;
+		}
+	}
+
+	return n;
+}
+
+static struct read_plan *build_read_plan(int version)
+{
+	const int size = version * 4 + 17;
+	const int num_bits = plan_cells(version, NULL);
+	const int num_bytes = ((num_bits + 63) >> 6) << 3;
+	struct read_plan *plan;
+	int i;
+
+	plan = (struct read_plan *)malloc(sizeof(*plan) + num_bytes * 8 +
+					  num_bits * sizeof(uint16_t));
+	if (!plan)
+		return NULL;
+
+	plan->num_bits = num_bits;
+	plan->num_bytes = num_bytes;
+	plan->masks = (uint8_t *)(plan + 1);
+	plan->cells = (uint16_t *)(plan->masks + num_bytes * 8);
+
+	plan_cells(version, plan->cells);
+	memset(plan->masks, 0, num_bytes * 8);
+
+	for (i = 0; i < num_bits; i++) {
+		const int y = plan->cells[i] / size;
+		const int x = plan->cells[i] % size;
+		int m;
+
+		for (m = 0; m < 8; m++)
+			if (mask_bit(m, y, x))
+				plan->masks[m * num_bytes + (i >> 3)] |=
+					0x80 >> (i & 7);
+	}
+
+	return plan;
+}
+
+static const struct read_plan *get_read_plan(int version)
+{
+	struct read_plan *plan = plan_load(&read_plans[version]);
+
+	if (plan)
+		return plan;
+
+	plan = build_read_plan(version);
+	if (!plan)
+		return NULL;
+
+	/* Another thread may have beaten us to it */
+	if (!plan_publish(&read_plans[version], plan)) {
+		free(plan);
+		plan = plan_load(&read_plans[version]);
+	}
+
+	return plan;
+}
+
+static void read_data(const struct quirc_code *code,
+		      struct quirc_data *data,
+		      struct datastream *ds)
+{
+	const struct read_plan *plan = get_read_plan(data->version);
+	const uint8_t *bitmap = code->cell_bitmap;
+	const uint16_t *cells;
+	const uint8_t *mask;
+	int i;
+
+	if (!plan) {
+		read_data_direct(code, data, ds);
+		return;
+	}
+
+	/* Gather the data modules, one codeword byte at a time */
+	cells = plan->cells;
+	for (i = 0; i < plan->num_bits; i += 8) {
+		const int n = plan->num_bits - i < 8 ? plan->num_bits - i : 8;
+		uint8_t b = 0;
+		int k;
+
+		for (k = 0; k < n; k++) {
+			const int p = cells[i + k];
+
+			b = (b << 1) | ((bitmap[p >> 3] >> (p & 7)) & 1);
+		}
+
+		ds->raw[i >> 3] = b << (8 - n);
+	}
+
+	/* Remove the mask, a word at a time. The tail of the last word
+	 * has no mask bits set, so bytes past the data are left alone.
+	 */
+	mask = plan->masks + data->mask * plan->num_bytes;
+	for (i = 0; i < plan->num_bytes; i += 8) {
+		uint64_t r;
+		uint64_t m;
+
+		memcpy(&r, ds->raw + i, sizeof(r));
+		memcpy(&m, mask + i, sizeof(m));
+		r ^= m;
+		memcpy(ds->raw + i, &r, sizeof(r));
+	}
+
+	ds->data_bits = plan->num_bits;
+}
+
 static quirc_decode_error_t codestream_ecc(struct quirc_data *data,
 					   struct datastream *ds)
 {
@@ -595,8 +867,14 @@ static quirc_decode_error_t codestream_ecc(struct quirc_data *data,
 		quirc_decode_error_t err;
 		int j;
 
-		for (j = 0; j < ecc->dw; j++)
+		for (j = 0; j < sb_ecc->dw; j++)
 			dst[j] = ds->raw[j * bc + i];
+
+		/* The extra data word of each large block is interleaved
+		 * after all the full rows, in large block order.
+		 */
+		if (ecc->dw > sb_ecc->dw)
+			dst[j] = ds->raw[sb_ecc->dw * bc + i - sb_ecc->ns];
 		for (j = 0; j < num_ec; j++)
 			dst[ecc->dw + j] = ds->raw[ecc_offset + j * bc + i];
 
@@ -617,23 +895,67 @@ static inline int bits_remaining(const struct datastream *ds)
 	return ds->data_bits - ds->ptr;
 }
 
+/* Load a big-endian 64-bit window. The data buffer is much larger than
+ * the longest codeword stream, so reading past data_bits is safe; those
+ * bits are never returned.
+ */
+static inline uint64_t load_be64(const uint8_t *p)
+{
+	return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) |
+	       ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+	       ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) |
+	       ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+}
+
+static inline void store_be64(uint8_t *p, uint64_t v)
+{
+	int i;
+
+	for (i = 7; i >= 0; i--) {
+		p[i] = (uint8_t)v;
+		v >>= 8;
+	}
+}
+
 static int take_bits(struct datastream *ds, int len)
 {
-	int ret = 0;
+	int avail = bits_remaining(ds);
+	uint64_t w;
 
-	while (len && (ds->ptr < ds->data_bits)) {
-		uint8_t b = ds->data[ds->ptr >> 3];
-		int bitpos = ds->ptr & 7;
+	if (len > avail)
+		len = avail;
+	if (len <= 0)
+		return 0;
 
-		ret <<= 1;
-		if ((b << bitpos) & 0x80)
-			ret |= 1;
+	/* At most 7 + 16 bits of the window are ever needed */
+	w = load_be64(ds->data + (ds->ptr >> 3)) << (ds->ptr & 7);
+	ds->ptr += len;
 
-		ds->ptr++;
-		len--;
+	return (int)(w >> (64 - len));
+}
+
+/* Copy count whole bytes from the stream, which needn't be byte
+ * aligned. Bounds must have been checked by the caller.
+ */
+static void take_bytes(struct datastream *ds, uint8_t *dst, int count)
+{
+	const uint8_t *src = ds->data + (ds->ptr >> 3);
+	const int shift = ds->ptr & 7;
+	int i = 0;
+
+	ds->ptr += count * 8;
+
+	if (!shift) {
+		memcpy(dst, src, count);
+		return;
 	}
 
-	return ret;
+	for (; i + 8 <= count; i += 8)
+		store_be64(dst + i, (load_be64(src + i) << shift) |
+				   (src[i + 8] >> (8 - shift)));
+
+	for (; i < count; i++)
+		dst[i] = (src[i] << shift) | (src[i + 1] >> (8 - shift));
 }
 
 static int numeric_tuple(struct quirc_data *data,
@@ -649,7 +971,7 @@ static int numeric_tuple(struct quirc_data *data,
 	tuple = take_bits(ds, bits);
 
 	for (i = digits - 1; i >= 0; i--) {
-		data->payload[data->payload_len + i] = tuple % 10 + '0';
+		ds->payload[data->payload_len + i] = tuple % 10 + '0';
 		tuple /= 10;
 	}
 
@@ -669,7 +991,7 @@ static quirc_decode_error_t decode_numeric(struct quirc_data *data,
 		bits = 12;
 
 	count = take_bits(ds, bits);
-	if (data->payload_len + count + 1 > QUIRC_MAX_PAYLOAD)
+	if (data->payload_len + count > ds->payload_max)
 		return QUIRC_ERROR_DATA_OVERFLOW;
 
 	while (count >= 3) {
@@ -709,7 +1031,7 @@ static int alpha_tuple(struct quirc_data *data,
 		static const char *alpha_map =
 			"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
 
-		data->payload[data->payload_len + digits - i - 1] =
+		ds->payload[data->payload_len + digits - i - 1] =
 			alpha_map[tuple % 45];
 		tuple /= 45;
 	}
@@ -730,7 +1052,7 @@ static quirc_decode_error_t decode_alpha(struct quirc_data *data,
 		bits = 11;
 
 	count = take_bits(ds, bits);
-	if (data->payload_len + count + 1 > QUIRC_MAX_PAYLOAD)
+	if (data->payload_len + count > ds->payload_max)
 		return QUIRC_ERROR_DATA_OVERFLOW;
 
 	while (count >= 2) {
@@ -753,23 +1075,29 @@ static quirc_decode_error_t decode_byte(struct quirc_data *data,
 {
 	int bits = 16;
 	int count;
-	int i;
 
 	if (data->version < 10)
 		bits = 8;
 
 	count = take_bits(ds, bits);
-	if (data->payload_len + count + 1 > QUIRC_MAX_PAYLOAD)
+	if (data->payload_len + count > ds->payload_max)
 		return QUIRC_ERROR_DATA_OVERFLOW;
 	if (bits_remaining(ds) < count * 8)
 		return QUIRC_ERROR_DATA_UNDERFLOW;
 
-	for (i = 0; i < count; i++)
-		data->payload[data->payload_len++] = take_bits(ds, 8);
+	take_bytes(ds, ds->payload + data->payload_len, count);
+	data->payload_len += count;
 
 	return QUIRC_SUCCESS;
 }
 
+static quirc_kanji_decoder_t kanji_decoder;
+
+void quirc_set_kanji_decoder(quirc_kanji_decoder_t decoder)
+{
+	kanji_decoder = decoder;
+}
+
 static quirc_decode_error_t decode_kanji(struct quirc_data *data,
 					 struct datastream *ds)
 {
@@ -783,22 +1111,36 @@ static quirc_decode_error_t decode_kanji(struct quirc_data *data,
 		bits = 10;
 
 	count = take_bits(ds, bits);
-	if (data->payload_len + count * 2 + 1 > QUIRC_MAX_PAYLOAD)
-		return QUIRC_ERROR_DATA_OVERFLOW;
 	if (bits_remaining(ds) < count * 13)
 		return QUIRC_ERROR_DATA_UNDERFLOW;
 
 	for (i = 0; i < count; i++) {
 		int d = take_bits(ds, 13);
+		int ms_b = d / 0xc0;
+		int ls_b = d % 0xc0;
+		int intermediate = (ms_b << 8) | ls_b;
+		uint8_t utf8[4];
+		int len = kanji_decoder ? kanji_decoder(d, utf8) : 0;
 		uint16_t sjw;
 
-		if (d + 0x8140 >= 0x9ffc)
-			sjw = d + 0x8140;
+		if (len > 0) {
+			if (data->payload_len + len > ds->payload_max)
+				return QUIRC_ERROR_DATA_OVERFLOW;
+			memcpy(ds->payload + data->payload_len, utf8, len);
+			data->payload_len += len;
+			continue;
+		}
+
+		if (data->payload_len + 2 > ds->payload_max)
+			return QUIRC_ERROR_DATA_OVERFLOW;
+
+		if (intermediate + 0x8140 <= 0x9ffc)
+			sjw = intermediate + 0x8140;
 		else
-			sjw = d + 0xc140;
+			sjw = intermediate + 0xc140;
 
-		data->payload[data->payload_len++] = sjw >> 8;
-		data->payload[data->payload_len++] = sjw & 0xff;
+		ds->payload[data->payload_len++] = sjw >> 8;
+		ds->payload[data->payload_len++] = sjw & 0xff;
 	}
 
 	return QUIRC_SUCCESS;
@@ -867,25 +1209,21 @@ static quirc_decode_error_t decode_payload(struct quirc_data *data,
 	}
 done:
 
-	/* Add nul terminator to all payloads */
-	if (data->payload_len >= sizeof(data->payload))
-		data->payload_len--;
-	data->payload[data->payload_len] = 0;
+	/* Add nul terminator to payloads stored in quirc_data */
+	if (ds->payload == data->payload) {
+		if (data->payload_len >= sizeof(data->payload))
+			data->payload_len--;
+		data->payload[data->payload_len] = 0;
+	}
 
 	return QUIRC_SUCCESS;
 }
 
-quirc_decode_error_t quirc_decode(const struct quirc_code *code,
-				  struct quirc_data *data)
+static quirc_decode_error_t decode_code(const struct quirc_code *code,
+				       struct quirc_data *data,
+				       struct datastream *ds)
 {
 	quirc_decode_error_t err;
-	struct datastream ds;
-
-	if ((code->size - 17) % 4)
-		return QUIRC_ERROR_INVALID_GRID_SIZE;
-
-	memset(data, 0, sizeof(*data));
-	memset(&ds, 0, sizeof(ds));
 
 	data->version = (code->size - 17) / 4;
 
@@ -900,14 +1238,122 @@ quirc_decode_error_t quirc_decode(const struct quirc_code *code,
 	if (err)
 		return err;
 
-	read_data(code, data, &ds);
-	err = codestream_ecc(data, &ds);
+	read_data(code, data, ds);
+	err = codestream_ecc(data, ds);
 	if (err)
 		return err;
 
-	err = decode_payload(data, &ds);
+	err = decode_payload(data, ds);
+	if (err)
+		return err;
+
+	return QUIRC_SUCCESS;
+}
+
+/* Prepare for a decode. Nothing else needs clearing: the codeword
+ * stream is written in full before it's read, and only the decoded part
+ * of the payload is ever looked at.
+ */
+static void reset_decode(struct quirc_data *data, struct datastream *ds,
+			 uint8_t *payload, int max_len)
+{
+	data->version = 0;
+	data->ecc_level = 0;
+	data->mask = 0;
+	data->data_type = 0;
+	data->payload_len = 0;
+	data->eci = 0;
+
+	ds->data_bits = 0;
+	ds->ptr = 0;
+	ds->payload = payload;
+	ds->payload_max = max_len;
+}
+
+quirc_decode_error_t quirc_decode(const struct quirc_code *code,
+				  struct quirc_data *data)
+{
+	struct datastream ds;
+
+	if ((code->size - 17) % 4)
+		return QUIRC_ERROR_INVALID_GRID_SIZE;
+
+	reset_decode(data, &ds, data->payload, QUIRC_MAX_PAYLOAD - 1);
+	return decode_code(code, data, &ds);
+}
+
+quirc_decode_error_t quirc_decode_into(const struct quirc_code *code,
+				       struct quirc_data *data,
+				       uint8_t *payload, int max_len)
+{
+	struct datastream ds;
+
+	if ((code->size - 17) % 4)
+		return QUIRC_ERROR_INVALID_GRID_SIZE;
+
+	/* data->payload is left alone */
+	reset_decode(data, &ds, payload, max_len);
+	return decode_code(code, data, &ds);
+}
+
+int quirc_payload_capacity(const struct quirc_code *code)
+{
+	int version = (code->size - 17) / 4;
+
+	if ((code->size - 17) % 4 ||
+	    version < 1 || version > QUIRC_MAX_VERSION)
+		return 0;
+
+	/* Numeric mode is the densest: 3 characters per 10 bits */
+	return (quirc_version_db[version].data_bytes * 8 * 3 + 9) / 10;
+}
+
+/************************************************************************
+ * Decoding with scratch space owned by the recognizer
+ */
+
+struct quirc_scratch {
+	struct quirc_code	code;
+	struct quirc_data	data;
+	struct datastream	ds;
+};
+
+const struct quirc_code *quirc_extract_scratch(struct quirc *q, int index)
+{
+	if (!q->scratch) {
+		q->scratch = (struct quirc_scratch *)calloc(1, sizeof(*q->scratch));
+		if (!q->scratch)
+			return NULL;
+	}
+
+	quirc_extract(q, index, &q->scratch->code);
+	return &q->scratch->code;
+}
+
+quirc_decode_error_t quirc_decode_scratch(struct quirc *q,
+					  const struct quirc_data **data,
+					  uint8_t *payload, int max_len)
+{
+	struct quirc_scratch *s = q->scratch;
+	quirc_decode_error_t err;
+
+	/* Nothing has been extracted */
+	if (!s)
+		return QUIRC_ERROR_INVALID_GRID_SIZE;
+
+	if ((s->code.size - 17) % 4)
+		return QUIRC_ERROR_INVALID_GRID_SIZE;
+
+	if (payload)
+		reset_decode(&s->data, &s->ds, payload, max_len);
+	else
+		reset_decode(&s->data, &s->ds, s->data.payload,
+			     QUIRC_MAX_PAYLOAD - 1);
+
+	err = decode_code(&s->code, &s->data, &s->ds);
 	if (err)
 		return err;
 
+	*data = &s->data;
 	return QUIRC_SUCCESS;
 }
@@ -1125,10 +1125,18 @@ void quirc_extract(const struct quirc *q, int index,
 	int y;
 	int i = 0;
 
-	if (index < 0 || index > q->num_grids)
+	code->size = 0;
+	if (index < 0 || index >= q->num_grids)
 		return;
 
-	memset(code, 0, sizeof(*code));
+	/* Only clear the part of the bitmap that the grid covers */
+	if (qr->grid_size * qr->grid_size > QUIRC_MAX_BITMAP * 8) {
+		memset(code, 0, sizeof(code->corners));
+		return;
+	}
+
+	memset(code->cell_bitmap, 0,
+	       (qr->grid_size * qr->grid_size + 7) >> 3);
 
 	perspective_map(qr->c, 0.0, 0.0, &code->corners[0]);
 	perspective_map(qr->c, qr->grid_size, 0.0, &code->corners[1]);
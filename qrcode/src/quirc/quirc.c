@@ -40,6 +40,8 @@ void quirc_destroy(struct quirc *q)
 		free(q->image);
 	if (sizeof(*q->image) != sizeof(*q->pixels))
 		free(q->pixels);
+	if (q->scratch)
+		free(q->scratch);
 
 	free(q);
 }
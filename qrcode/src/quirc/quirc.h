@@ -144,7 +144,9 @@ struct quirc_data {
 	int			data_type;
 
 	/* Data payload. For the Kanji datatype, payload is encoded as
-	 * Shift-JIS. For all other datatypes, payload is ASCII text.
+	 * Shift-JIS (unless a Kanji decoder is set, see
+	 * quirc_set_kanji_decoder()). For all other datatypes, payload is
+	 * ASCII text.
 	 */
 	uint8_t			payload[QUIRC_MAX_PAYLOAD];
 	int			payload_len;
@@ -166,6 +168,53 @@ void quirc_extract(const struct quirc *q, int index,
 quirc_decode_error_t quirc_decode(const struct quirc_code *code,
 				  struct quirc_data *data);
 
+/* Decode a QR-code, writing the payload straight into a caller-supplied
+ * buffer of max_len bytes instead of data->payload, which is left
+ * untouched. No nul terminator is added; the length is returned in
+ * data->payload_len. Returns QUIRC_ERROR_DATA_OVERFLOW if the payload
+ * doesn't fit.
+ */
+quirc_decode_error_t quirc_decode_into(const struct quirc_code *code,
+				       struct quirc_data *data,
+				       uint8_t *payload, int max_len);
+
+/* Converts a 13-bit Kanji mode value to UTF-8, writing at most 4 bytes
+ * to utf8. Returns the number of bytes written, or 0 to keep the
+ * Shift-JIS bytes of the character.
+ */
+typedef int (*quirc_kanji_decoder_t)(int value, uint8_t *utf8);
+
+/* Set the decoder used for the Kanji segments by all the decoding
+ * functions, or NULL for Shift-JIS (the default).
+ */
+void quirc_set_kanji_decoder(quirc_kanji_decoder_t decoder);
+
+/* Return an upper bound on the payload length of a code, based on its
+ * size alone. A buffer of this size is always large enough for
+ * quirc_decode_into(). Returns 0 if the size is invalid.
+ */
+int quirc_payload_capacity(const struct quirc_code *code);
+
+/* Extract and decode using scratch space owned by the recognizer.
+ *
+ * quirc_extract() and quirc_decode() need a quirc_code, a quirc_data
+ * and the decoder's intermediate state, almost 30 kB in total, which
+ * callers usually keep on the stack. Instead, quirc_extract_scratch()
+ * extracts the code at the given index into space allocated once by
+ * the recognizer, and returns it (or NULL if that space couldn't be
+ * allocated). quirc_decode_scratch() then decodes the last extracted
+ * code, and only clears the state that the code's version can touch.
+ *
+ * On success, *data points to a quirc_data owned by the recognizer,
+ * valid until the next extraction or quirc_destroy(). If payload is not
+ * NULL, the payload is written there instead, as with
+ * quirc_decode_into().
+ */
+const struct quirc_code *quirc_extract_scratch(struct quirc *q, int index);
+quirc_decode_error_t quirc_decode_scratch(struct quirc *q,
+					  const struct quirc_data **data,
+					  uint8_t *payload, int max_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -78,6 +78,9 @@ struct quirc_grid {
 	double			c[QUIRC_PERSPECTIVE_PARAMS];
 };
 
+/* Decoder state owned by a recognizer, see quirc_decode_scratch() */
+struct quirc_scratch;
+
 struct quirc {
 	uint8_t			*image;
 	quirc_pixel_t		*pixels;
@@ -92,6 +95,8 @@ struct quirc {
 
 	int			num_grids;
 	struct quirc_grid	grids[QUIRC_MAX_GRIDS];
+
+	struct quirc_scratch	*scratch;
 };
 
 /************************************************************************